@@ -39,6 +39,7 @@ extern const unsigned char ObjectiveRocksVersionString[];
 #import "RocksDBWriteOptions.h"
 #import "RocksDBReadOptions.h"
 #import "RocksDBCompactRangeOptions.h"
+#import "RocksDBCompressionOptions.h"
 
 // Env
 #import "RocksDBEnv.h"
@@ -51,6 +52,7 @@ extern const unsigned char ObjectiveRocksVersionString[];
 
 // Memtable
 #import "RocksDBMemTableRepFactory.h"
+#import "RocksDBWriteBufferManager.h"
 
 // Snapshot
 #import "RocksDBSnapshot.h"
@@ -59,6 +61,12 @@ extern const unsigned char ObjectiveRocksVersionString[];
 // Merge Operator
 #import "RocksDBMergeOperator.h"
 
+// Compaction Filter
+#import "RocksDBCompactionFilter.h"
+
+// Perf Context
+#import "RocksDBPerfContext.h"
+
 //// OSX Only
 #if !(defined(ROCKSDB_LITE) && defined(TARGET_OS_IPHONE))
 
@@ -75,9 +83,11 @@ extern const unsigned char ObjectiveRocksVersionString[];
 // Table
 #import "RocksDBPlainTableOptions.h"
 #import "RocksDBCuckooTableOptions.h"
+#import "RocksDBPersistentCache.h"
 
 // Properties
 #import "RocksDBProperties.h"
+#import "RocksDBMemoryUsage.h"
 
 // Snapshot
 #import "RocksDBCheckpoint.h"
@@ -85,6 +95,13 @@ extern const unsigned char ObjectiveRocksVersionString[];
 // Statistics
 #import "RocksDBStatistics.h"
 #import "RocksDBStatisticsHistogram.h"
+#import "RocksDBStatisticsSnapshot.h"
+
+// Event Listener
+#import "RocksDBEventListener.h"
+
+// Metrics
+#import "RocksDBMetricsExporter.h"
 
 // Backup
 #import "RocksDBBackupEngine.h"
@@ -40,4 +40,9 @@ namespace rocksdb {
  */
 @property (nonatomic, retain) RocksDBWriteOptions *writeOptions;
 
+#if !(defined(ROCKSDB_LITE) && defined(TARGET_OS_IPHONE))
+/** @brief Stops all running block cache warm-ups of this instance and waits for them to finish. */
+- (void)cancelBlockCacheWarmUp;
+#endif
+
 @end
@@ -22,6 +22,7 @@
 #import "RocksDBColumnFamilyMetadata.h"
 #import "RocksDBIndexedWriteBatch.h"
 #import "RocksDBProperties.h"
+#import "RocksDBMemoryUsage.h"
 #endif
 
 NS_ASSUME_NONNULL_BEGIN
@@ -249,6 +250,167 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (uint64_t)valueForIntProperty:(RocksDBIntProperty)property;
 
+/**
+ Returns the integer values for the given int properties of all Column Families at once.
+
+ @discussion If the database was opened with a `RocksDBColumnFamilyDescriptor` the values are read for all
+ Column Families opened with it, otherwise only for the Column Family associated with this instance. The
+ property names are resolved once for all Column Families. Properties that aren't available for a Column
+ Family, e.g. `RocksDBIntPropertyEstimatedOldestKeyTime` for non-FIFO compaction, are omitted.
+
+ @param properties An array of `RocksDBIntProperty` values wrapped in `NSNumber`s.
+ @return A dictionary mapping each Column Family name to a dictionary mapping the wrapped
+ `RocksDBIntProperty` to its wrapped `uint64_t` value.
+
+ @see RocksDBProperties.h
+
+ @warning Not available in RocksDB Lite.
+ */
+- (NSDictionary<NSString *, NSDictionary<NSNumber *, NSNumber *> *> *)valuesForIntProperties:(NSArray<NSNumber *> *)properties;
+
+@end
+
+#endif
+
+#if !(defined(ROCKSDB_LITE) && defined(TARGET_OS_IPHONE))
+
+#pragma mark - Memory usage
+
+@interface RocksDB (MemoryUsage)
+
+///--------------------------------
+/// @name Memory usage
+///--------------------------------
+
+/**
+ Returns the approximate memory usage of the given databases and caches, broken down by type.
+
+ @discussion Column Families of the same database are counted once. Pass all caches used by the databases,
+ e.g. the block caches set in their `RocksDBBlockBasedTableOptions`, to include them in the breakdown.
+
+ @param databases The database instances.
+ @param caches The caches used by the databases.
+ @return The approximate memory usage, or nil if it couldn't be computed.
+
+ @see RocksDBMemoryUsage
+
+ @warning Not available in RocksDB Lite.
+ */
++ (nullable RocksDBMemoryUsage *)approximateMemoryUsageForDatabases:(NSArray<RocksDB *> *)databases
+															 caches:(nullable NSArray<RocksDBCache *> *)caches;
+
+@end
+
+#endif
+
+#if !(defined(ROCKSDB_LITE) && defined(TARGET_OS_IPHONE))
+
+#pragma mark - Row cache
+
+@interface RocksDB (RowCache)
+
+///--------------------------------
+/// @name Row cache
+///--------------------------------
+
+/**
+ Returns the number of point lookups on this Column Family that were served by the row cache.
+
+ @discussion Lookups are counted per Column Family across all instances of the database, but only
+ the ones made via `dataForKey:`. Returns 0 if no `rowCache` is set in the database options.
+
+ @see -[RocksDBDatabaseOptions rowCache]
+
+ @warning Not available in RocksDB Lite.
+ */
+- (uint64_t)rowCacheHitCount;
+
+/**
+ Returns the number of point lookups on this Column Family that missed the row cache.
+
+ @see rowCacheHitCount
+
+ @warning Not available in RocksDB Lite.
+ */
+- (uint64_t)rowCacheMissCount;
+
+@end
+
+#endif
+
+#if !(defined(ROCKSDB_LITE) && defined(TARGET_OS_IPHONE))
+
+#pragma mark - Block cache warm-up
+
+@interface RocksDB (BlockCacheWarmUp)
+
+///--------------------------------
+/// @name Block cache warm-up
+///--------------------------------
+
+/**
+ Loads the index and filter blocks of all table files of this Column Family and the data blocks of the
+ given key ranges into the block cache, on a background queue.
+
+ @discussion The index and filter blocks are only loaded into the block cache if `cacheIndexAndFilterBlocks`
+ is set in the `RocksDBBlockBasedTableOptions`, otherwise they are held by the opened table readers.
+ Closing the database cancels the warm-up and waits for it to stop, in which case the completion
+ block is called with an error.
+
+ @param ranges The key ranges whose data blocks are loaded, or nil to load only the index and filter blocks.
+ @param completion A block called on an arbitrary queue once the warm-up is finished.
+
+ @warning Not available in RocksDB Lite.
+ */
+- (void)warmUpBlockCacheForRanges:(nullable NSArray<RocksDBKeyRange *> *)ranges
+					   completion:(nullable void (^)(NSError * _Nullable error))completion;
+
+/**
+ Starts sampling the keys read via `dataForKey:` on this Column Family, so that they can be dumped
+ with `dumpHotKeysToFileAtPath:error:`.
+
+ @discussion Every 16th lookup is sampled into a ring buffer, thus keys that are read frequently are
+ the most likely to be kept. Safe to call while other threads read from the database.
+
+ @param capacity The maximum number of keys kept.
+
+ @warning Not available in RocksDB Lite.
+ */
+- (void)startTrackingHotKeysWithCapacity:(NSUInteger)capacity;
+
+/**
+ Writes the sampled hot keys whose blocks are still in the block cache to the file at the given path.
+
+ @discussion Block cache keys are derived from the table files' identities and aren't stable across
+ restarts, hence the user keys are dumped instead. Call this before closing the database and pass
+ the file to `warmUpBlockCacheFromHotKeysFileAtPath:completion:` after the next open. Alternatively, set
+ `hotKeysFilePath` in the database options to dump the keys on close and warm up from them on open.
+
+ @param path The path of the file.
+ @param error If an error occurs, upon return contains an `NSError` object that describes the problem.
+ @return `YES` if the file was written, `NO` otherwise.
+
+ @see startTrackingHotKeysWithCapacity:
+
+ @warning Not available in RocksDB Lite.
+ */
+- (BOOL)dumpHotKeysToFileAtPath:(NSString *)path error:(NSError * _Nullable *)error;
+
+/**
+ Loads the index and filter blocks of all table files of this Column Family and the data blocks of
+ the keys dumped via `dumpHotKeysToFileAtPath:error:` into the block cache, on a background queue.
+
+ @discussion Closing the database cancels the warm-up and waits for it to stop, in which case the
+ completion block is called with an error.
+
+ @param path The path of the file written by `dumpHotKeysToFileAtPath:error:`.
+ @param completion A block called on an arbitrary queue once the warm-up is finished.
+
+ @warning Not available in RocksDB Lite.
+ */
+- (void)warmUpBlockCacheFromHotKeysFileAtPath:(NSString *)path
+								   completion:(nullable void (^)(NSError * _Nullable error))completion;
+
 @end
 
 #endif
@@ -32,10 +32,19 @@
 #include <rocksdb/slice.h>
 #include <rocksdb/options.h>
 
+#include <algorithm>
+
 #if !(defined(ROCKSDB_LITE) && defined(TARGET_OS_IPHONE))
 #import "RocksDBColumnFamilyMetaData+Private.h"
 #import "RocksDBIndexedWriteBatch+Private.h"
 #import "RocksDBProperties.h"
+#import "RocksDBMemoryUsage.h"
+#import "RocksDBCache.h"
+#import "RocksDBNativeRowCache.h"
+#import "RocksDBNativeHotKeyTracker.h"
+
+#include <rocksdb/utilities/memory_util.h>
+#include <atomic>
 #endif
 
 #pragma mark -
@@ -44,6 +53,19 @@
 @property (nonatomic, assign) std::vector<rocksdb::ColumnFamilyDescriptor> *columnFamilies;
 @end
 
+#if !(defined(ROCKSDB_LITE) && defined(TARGET_OS_IPHONE))
+
+@interface RocksDBCache ()
+@property (nonatomic, assign) std::shared_ptr<rocksdb::Cache> cache;
+@end
+
+@interface RocksDBMemoryUsage ()
+- (instancetype)initWithNativeUsage:(const std::map<rocksdb::MemoryUtil::UsageType, uint64_t> &)usage
+							 caches:(NSArray<RocksDBCache *> *)caches;
+@end
+
+#endif
+
 @interface RocksDB ()
 {
 	NSString *_path;
@@ -56,6 +78,13 @@
 	RocksDBOptions *_options;
 	RocksDBReadOptions *_readOptions;
 	RocksDBWriteOptions *_writeOptions;
+
+#if !(defined(ROCKSDB_LITE) && defined(TARGET_OS_IPHONE))
+	RocksDBRowCacheCounters *_rowCacheCounters;
+	std::atomic<RocksDBHotKeyTracker *> _hotKeyTracker;
+	dispatch_group_t _warmUpGroup;
+	std::atomic<bool> _warmUpCancelled;
+#endif
 }
 @property (nonatomic, strong) NSString *path;
 @property (nonatomic, assign) rocksdb::DB *db;
@@ -159,13 +188,35 @@
 - (void)dealloc
 {
 	[self close];
+
+#if !(defined(ROCKSDB_LITE) && defined(TARGET_OS_IPHONE))
+	delete _hotKeyTracker.load();
+#endif
+}
+
+- (void)setColumnFamily:(rocksdb::ColumnFamilyHandle *)columnFamily
+{
+	_columnFamily = columnFamily;
+#if !(defined(ROCKSDB_LITE) && defined(TARGET_OS_IPHONE))
+	_rowCacheCounters = RocksDBRowCacheCountersForColumnFamily(_db, _columnFamily);
+#endif
 }
 
 - (void)close
 {
+#if !(defined(ROCKSDB_LITE) && defined(TARGET_OS_IPHONE))
+	[self cancelBlockCacheWarmUp];
+#endif
+
 	@synchronized(self) {
 		[_columnFamilies makeObjectsPerformSelector:@selector(close)];
 
+#if !(defined(ROCKSDB_LITE) && defined(TARGET_OS_IPHONE))
+		if (_db != nullptr && _hotKeyTracker.load(std::memory_order_acquire) != nullptr && _options.hotKeysFilePath != nil) {
+			[self dumpHotKeysToFileAtPath:_options.hotKeysFilePath error:nil];
+		}
+#endif
+
 		if (_columnFamilyHandles != nullptr) {
 			delete _columnFamilyHandles;
 			_columnFamilyHandles = nullptr;
@@ -200,7 +251,13 @@
 		[self close];
 		return NO;
 	}
-	_columnFamily = _db->DefaultColumnFamily();
+	self.columnFamily = _db->DefaultColumnFamily();
+
+#if !(defined(ROCKSDB_LITE) && defined(TARGET_OS_IPHONE))
+	if (_options.hotKeysFilePath != nil) {
+		[self warmUpBlockCacheFromHotKeysFileAtPath:_options.hotKeysFilePath completion:nil];
+	}
+#endif
 
 	return YES;
 }
@@ -231,7 +288,13 @@
 		[self close];
 		return NO;
 	}
-	_columnFamily = _db->DefaultColumnFamily();
+	self.columnFamily = _db->DefaultColumnFamily();
+
+#if !(defined(ROCKSDB_LITE) && defined(TARGET_OS_IPHONE))
+	if (_options.hotKeysFilePath != nil) {
+		[self warmUpBlockCacheFromHotKeysFileAtPath:_options.hotKeysFilePath completion:nil];
+	}
+#endif
 
 	return YES;
 }
@@ -303,7 +366,16 @@
 	rocksdb::ColumnFamilyMetaData metadata;
 	_db->GetColumnFamilyMetaData(_columnFamily, &metadata);
 
-	RocksDBColumnFamilyMetaData *columnFamilyMetaData = [[RocksDBColumnFamilyMetaData alloc] initWithMetaData:metadata];
+	std::vector<double> compressionRatios;
+	for (const auto &level : metadata.levels) {
+		std::string value;
+		std::string property = rocksdb::DB::Properties::kCompressionRatioAtLevelPrefix + std::to_string(level.level);
+		bool ok = _db->GetProperty(_columnFamily, property, &value);
+		compressionRatios.push_back(ok ? std::stod(value) : -1.0);
+	}
+
+	RocksDBColumnFamilyMetaData *columnFamilyMetaData = [[RocksDBColumnFamilyMetaData alloc] initWithMetaData:metadata
+																					compressionRatios:compressionRatios];
 	return columnFamilyMetaData;
 }
 
@@ -355,6 +427,257 @@
 	return value;
 }
 
+- (NSDictionary<NSString *, NSDictionary<NSNumber *, NSNumber *> *> *)valuesForIntProperties:(NSArray<NSNumber *> *)properties
+{
+	std::vector<std::string> names;
+	names.reserve(properties.count);
+	for (NSNumber *property in properties) {
+		names.push_back(ResolveIntProperty((RocksDBIntProperty)property.unsignedIntegerValue).UTF8String);
+	}
+
+	std::vector<rocksdb::ColumnFamilyHandle *> handles;
+	if (_columnFamilyHandles != nullptr) {
+		handles = *_columnFamilyHandles;
+	} else {
+		handles.push_back(_columnFamily);
+	}
+
+	NSMutableDictionary *values = [NSMutableDictionary dictionaryWithCapacity:handles.size()];
+	for (auto handle : handles) {
+		NSMutableDictionary *columnFamilyValues = [NSMutableDictionary dictionaryWithCapacity:names.size()];
+		for (size_t idx = 0; idx < names.size(); idx++) {
+			uint64_t value;
+			if (_db->GetIntProperty(handle, names[idx], &value)) {
+				columnFamilyValues[properties[idx]] = @(value);
+			}
+		}
+		NSString *name = [NSString stringWithCString:handle->GetName().c_str() encoding:NSUTF8StringEncoding];
+		values[name] = columnFamilyValues;
+	}
+	return values;
+}
+
+#pragma mark - Memory Usage
+
++ (RocksDBMemoryUsage *)approximateMemoryUsageForDatabases:(NSArray<RocksDB *> *)databases caches:(NSArray<RocksDBCache *> *)caches
+{
+	std::vector<rocksdb::DB *> dbs;
+	for (RocksDB *database in databases) {
+		if (database.db != nullptr && std::find(dbs.begin(), dbs.end(), database.db) == dbs.end()) {
+			dbs.push_back(database.db);
+		}
+	}
+
+	std::unordered_set<const rocksdb::Cache *> cacheSet;
+	for (RocksDBCache *cache in caches) {
+		cacheSet.insert(cache.cache.get());
+	}
+
+	std::map<rocksdb::MemoryUtil::UsageType, uint64_t> usage;
+	rocksdb::Status status = rocksdb::MemoryUtil::GetApproximateMemoryUsageByType(dbs, cacheSet, &usage);
+	if (!status.ok()) {
+		NSLog(@"Error computing approximate memory usage: %@", [RocksDBError errorWithRocksStatus:status]);
+		return nil;
+	}
+
+	return [[RocksDBMemoryUsage alloc] initWithNativeUsage:usage caches:caches ?: @[]];
+}
+
+#pragma mark - Row Cache
+
+- (uint64_t)rowCacheHitCount
+{
+	return _rowCacheCounters != nullptr ? _rowCacheCounters->hits.load() : 0;
+}
+
+- (uint64_t)rowCacheMissCount
+{
+	return _rowCacheCounters != nullptr ? _rowCacheCounters->misses.load() : 0;
+}
+
+#pragma mark - Block Cache Warm-Up
+
+static const size_t kWarmUpReadaheadSize = 2 * 1024 * 1024;
+
+- (void)warmUpBlockCacheForRanges:(NSArray<RocksDBKeyRange *> *)ranges completion:(void (^)(NSError *error))completion
+{
+	NSArray<RocksDBKeyRange *> *rangesCopy = [ranges copy];
+	[self performBlockCacheWarmUp:^NSError * {
+		rocksdb::Status status = [self loadTableFiles];
+		for (RocksDBKeyRange *range in rangesCopy) {
+			if (!status.ok()) {
+				break;
+			}
+			status = [self loadDataBlocksInRange:range];
+		}
+		return status.ok() ? nil : [RocksDBError errorWithRocksStatus:status];
+	} completion:completion];
+}
+
+- (void)startTrackingHotKeysWithCapacity:(NSUInteger)capacity
+{
+	@synchronized(self) {
+		if (_hotKeyTracker.load(std::memory_order_relaxed) == nullptr) {
+			_hotKeyTracker.store(new RocksDBHotKeyTracker(capacity), std::memory_order_release);
+		}
+	}
+}
+
+- (BOOL)dumpHotKeysToFileAtPath:(NSString *)path error:(NSError * __autoreleasing *)error
+{
+	NSMutableArray<NSData *> *keys = [NSMutableArray array];
+	RocksDBHotKeyTracker *hotKeyTracker = _hotKeyTracker.load(std::memory_order_acquire);
+	if (hotKeyTracker != nullptr) {
+		rocksdb::ReadOptions readOptions;
+		readOptions.read_tier = rocksdb::kBlockCacheTier;
+
+		std::string value;
+		for (const auto &key : hotKeyTracker->Keys()) {
+			// Keys whose blocks were evicted in the meantime aren't hot anymore
+			rocksdb::Status status = _db->Get(readOptions, _columnFamily, key, &value);
+			if (status.ok() || status.IsNotFound()) {
+				[keys addObject:DataFromSlice(key)];
+			}
+		}
+	}
+
+	NSData *data = [NSPropertyListSerialization dataWithPropertyList:keys
+															  format:NSPropertyListBinaryFormat_v1_0
+															 options:0
+															   error:error];
+	return data != nil && [data writeToFile:path options:NSDataWritingAtomic error:error];
+}
+
+- (void)warmUpBlockCacheFromHotKeysFileAtPath:(NSString *)path completion:(void (^)(NSError *error))completion
+{
+	[self performBlockCacheWarmUp:^NSError * {
+		NSError *error = nil;
+		NSData *data = [NSData dataWithContentsOfFile:path options:0 error:&error];
+		NSArray<NSData *> *keys = nil;
+		if (data != nil) {
+			keys = [NSPropertyListSerialization propertyListWithData:data
+															 options:NSPropertyListImmutable
+															  format:NULL
+															   error:&error];
+		}
+		if (keys != nil && ![keys isKindOfClass:[NSArray class]]) {
+			keys = nil;
+			error = [NSError errorWithDomain:NSCocoaErrorDomain code:NSPropertyListReadCorruptError userInfo:nil];
+		}
+
+		if (keys != nil) {
+			rocksdb::Status status = [self loadTableFiles];
+
+			std::string value;
+			for (NSData *key in keys) {
+				if (!status.ok() || [self isBlockCacheWarmUpCancelled]) {
+					break;
+				}
+				if (![key isKindOfClass:[NSData class]]) {
+					continue;
+				}
+				status = _db->Get(rocksdb::ReadOptions(), _columnFamily, SliceFromData(key), &value);
+				if (status.IsNotFound()) {
+					status = rocksdb::Status::OK();
+				}
+			}
+
+			if (!status.ok()) {
+				error = [RocksDBError errorWithRocksStatus:status];
+			}
+		}
+		return error;
+	} completion:completion];
+}
+
+- (void)performBlockCacheWarmUp:(NSError * (^)(void))warmUpBlock completion:(void (^)(NSError *error))completion
+{
+	dispatch_group_t group;
+	@synchronized(self) {
+		if (_warmUpGroup == nil) {
+			_warmUpGroup = dispatch_group_create();
+		}
+		group = _warmUpGroup;
+	}
+
+	// The completion block is called outside of the group, so that it may close the database
+	dispatch_group_enter(group);
+	dispatch_async(dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
+		NSError *error = warmUpBlock();
+		if (error == nil && [self isBlockCacheWarmUpCancelled]) {
+			error = [RocksDBError errorWithRocksStatus:rocksdb::Status::Aborted("The database was closed")];
+		}
+		dispatch_group_leave(group);
+
+		if (completion) {
+			completion(error);
+		}
+	});
+}
+
+- (BOOL)isBlockCacheWarmUpCancelled
+{
+	return _warmUpCancelled.load(std::memory_order_relaxed);
+}
+
+- (void)cancelBlockCacheWarmUp
+{
+	_warmUpCancelled.store(true, std::memory_order_relaxed);
+
+	dispatch_group_t group;
+	@synchronized(self) {
+		group = _warmUpGroup;
+	}
+	if (group != nil) {
+		dispatch_group_wait(group, DISPATCH_TIME_FOREVER);
+	}
+}
+
+- (rocksdb::Status)loadTableFiles
+{
+	std::vector<rocksdb::LiveFileMetaData> files;
+	_db->GetLiveFilesMetaData(&files);
+
+	rocksdb::ReadOptions readOptions;
+	readOptions.total_order_seek = true;
+	std::unique_ptr<rocksdb::Iterator> iterator(_db->NewIterator(readOptions, _columnFamily));
+
+	// Seeking into each file opens its table reader, which loads the index and filter blocks
+	const std::string &name = _columnFamily->GetName();
+	for (const auto &file : files) {
+		if ([self isBlockCacheWarmUpCancelled]) {
+			break;
+		}
+		if (file.column_family_name == name) {
+			iterator->Seek(file.smallestkey);
+		}
+	}
+	return iterator->status();
+}
+
+- (rocksdb::Status)loadDataBlocksInRange:(RocksDBKeyRange *)range
+{
+	rocksdb::Slice upperBound = SliceFromData(range.end);
+
+	rocksdb::ReadOptions readOptions;
+	readOptions.total_order_seek = true;
+	readOptions.readahead_size = kWarmUpReadaheadSize;
+	if (range.end != nil) {
+		readOptions.iterate_upper_bound = &upperBound;
+	}
+
+	std::unique_ptr<rocksdb::Iterator> iterator(_db->NewIterator(readOptions, _columnFamily));
+	if (range.start != nil) {
+		iterator->Seek(SliceFromData(range.start));
+	} else {
+		iterator->SeekToFirst();
+	}
+	while (iterator->Valid() && ![self isBlockCacheWarmUpCancelled]) {
+		iterator->Next();
+	}
+	return iterator->status();
+}
+
 #endif
 
 #pragma mark - Write Operations
@@ -440,6 +763,13 @@
 	}
 
 	std::string value;
+#if !(defined(ROCKSDB_LITE) && defined(TARGET_OS_IPHONE))
+	RocksDBRowCacheScope rowCacheScope(_rowCacheCounters);
+	RocksDBHotKeyTracker *hotKeyTracker = _hotKeyTracker.load(std::memory_order_acquire);
+	if (hotKeyTracker != nullptr) {
+		hotKeyTracker->Offer(SliceFromData(aKey));
+	}
+#endif
 	rocksdb::Status status = _db->Get(readOptions.options,
 									  _columnFamily,
 									  SliceFromData(aKey),
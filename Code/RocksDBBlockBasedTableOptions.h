@@ -10,6 +10,10 @@
 #import "RocksDBCache.h"
 #import "RocksDBFilterPolicy.h"
 
+#if !(defined(ROCKSDB_LITE) && defined(TARGET_OS_IPHONE))
+#import "RocksDBPersistentCache.h"
+#endif
+
 NS_ASSUME_NONNULL_BEGIN
 
 typedef NS_ENUM(char, BlockBasedTableIndexType)
@@ -27,7 +31,29 @@ typedef NS_ENUM(char, BlockBasedTableIndexType)
 	 
 	 @see RocksDBPrefixExtractor
 	 */
-	BlockBasedTableIndexHashSearch
+	BlockBasedTableIndexHashSearch,
+
+	/**
+	 @brief A two-level index implementation. The index is partitioned into
+	 blocks of `metadataBlockSize`, and only a small top-level index over the
+	 partitions has to be kept in memory. Both levels are binary-search based.
+	 */
+	BlockBasedTableIndexTwoLevelIndexSearch
+};
+
+typedef NS_ENUM(char, BlockBasedTableDataBlockIndexType)
+{
+	/**
+	 @brief Binary search over the restart points of a data block.
+	 */
+	BlockBasedTableDataBlockIndexBinarySearch,
+
+	/**
+	 @brief Additionally appends a hash table of the keys to each data block,
+	 so that point lookups avoid the binary search in the block. Seeks still
+	 use the binary search.
+	 */
+	BlockBasedTableDataBlockIndexBinaryAndHash
 };
 
 typedef NS_ENUM(char, BlockBasedTableChecksumType) {
@@ -46,6 +72,31 @@ typedef NS_ENUM(char, BlockBasedTableChecksumType) {
  */
 @property (nonatomic, assign) BOOL cacheIndexAndFilterBlocks;
 
+/**
+ @brief
+ If cacheIndexAndFilterBlocks is enabled, cache index and filter blocks with
+ high priority. If set to true, depending on the implementation of the block
+ cache, index and filter blocks may be less likely to be evicted than data blocks.
+ @see +[RocksDBCache LRUCacheWithCapacity:numShardsBits:strictCapacityLimit:highPriorityPoolRatio:]
+ */
+@property (nonatomic, assign) BOOL cacheIndexAndFilterBlocksWithHighPriority;
+
+/**
+ @brief
+ If cacheIndexAndFilterBlocks is enabled, pin the index and filter blocks of
+ level-0 files in the block cache, so that they are never evicted.
+ */
+@property (nonatomic, assign) BOOL pinL0FilterAndIndexBlocksInCache;
+
+/**
+ @brief
+ If cacheIndexAndFilterBlocks is enabled and the index or filters are partitioned,
+ pin the top-level index and filter blocks in the block cache. The partitions
+ themselves are cached, and evicted, like data blocks.
+ The default is true.
+ */
+@property (nonatomic, assign) BOOL pinTopLevelIndexAndFilter;
+
 /**
  @brief The index type that will be used for this table.
  */
@@ -60,6 +111,39 @@ typedef NS_ENUM(char, BlockBasedTableChecksumType) {
  */
 @property (nonatomic, assign) BOOL hashIndexAllowCollision;
 
+/**
+ @brief
+  Partition the full filter of each table file into blocks of `metadataBlockSize`,
+  with a top-level index over the partitions. Requires the
+  `BlockBasedTableIndexTwoLevelIndexSearch` index type and a full filter policy,
+  otherwise the setting is ignored and unpartitioned filters are written.
+ */
+@property (nonatomic, assign) BOOL partitionFilters;
+
+/**
+ @brief
+  The target size of the index and filter partitions, when the index type is
+  `BlockBasedTableIndexTwoLevelIndexSearch` or partitionFilters is enabled.
+  The default is 4096.
+ */
+@property (nonatomic, assign) uint64_t metadataBlockSize;
+
+/**
+ @brief
+  The index type of the data blocks, binary search or binary search and hash.
+  The default is `BlockBasedTableDataBlockIndexBinarySearch`.
+ */
+@property (nonatomic, assign) BlockBasedTableDataBlockIndexType dataBlockIndexType;
+
+/**
+ @brief
+  The utilization ratio of the data blocks' hash tables, i.e. the number of keys
+  divided by the number of buckets, if `BlockBasedTableDataBlockIndexBinaryAndHash`
+  is used. Lower ratios reduce hash collisions at the cost of a larger block.
+  The default is 0.75.
+ */
+@property (nonatomic, assign) double dataBlockHashTableUtilRatio;
+
 /**
  @brief
   Use the specified checksum type. Newly created table files will be
@@ -93,6 +177,20 @@ typedef NS_ENUM(char, BlockBasedTableChecksumType) {
  */
 @property (nonatomic, strong, nullable) RocksDBCache *blockCacheCompressed;
 
+#if !(defined(ROCKSDB_LITE) && defined(TARGET_OS_IPHONE))
+/**
+ @brief
+  Use the specified persistent cache as a secondary tier for blocks
+  missing from the block cache, e.g. on a local SSD.
+  If nil, no persistent cache is used.
+
+ @see RocksDBPersistentCache
+
+ @warning Not available in RocksDB Lite.
+ */
+@property (nonatomic, strong, nullable) RocksDBPersistentCache *persistentCache;
+#endif
+
 /**
  @brief
   Approximate size of user data packed per block.  Note that the
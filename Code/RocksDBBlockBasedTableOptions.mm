@@ -16,9 +16,16 @@
 @end
 
 @interface RocksDBFilterPolicy ()
-@property (nonatomic, assign) const rocksdb::FilterPolicy *filterPolicy;
+@property (nonatomic, assign) std::shared_ptr<const rocksdb::FilterPolicy> filterPolicy;
 @end
 
+#if !(defined(ROCKSDB_LITE) && defined(TARGET_OS_IPHONE))
+#import <rocksdb/persistent_cache.h>
+@interface RocksDBPersistentCache ()
+@property (nonatomic, assign) std::shared_ptr<rocksdb::PersistentCache> persistentCache;
+@end
+#endif
+
 @interface RocksDBBlockBasedTableOptions ()
 {
 	rocksdb::BlockBasedTableOptions _options;
@@ -26,6 +33,9 @@
 	RocksDBCache *_blockCacheWrapper;
 	RocksDBCache *_blockCacheCompressedWrapper;
 	RocksDBFilterPolicy *_filterPolicyWrapper;
+#if !(defined(ROCKSDB_LITE) && defined(TARGET_OS_IPHONE))
+	RocksDBPersistentCache *_persistentCacheWrapper;
+#endif
 }
 @property (nonatomic, assign) rocksdb::BlockBasedTableOptions options;
 @end
@@ -57,6 +67,36 @@
 	return _options.cache_index_and_filter_blocks;
 }
 
+- (void)setCacheIndexAndFilterBlocksWithHighPriority:(BOOL)cacheIndexAndFilterBlocksWithHighPriority
+{
+	_options.cache_index_and_filter_blocks_with_high_priority = cacheIndexAndFilterBlocksWithHighPriority;
+}
+
+- (BOOL)cacheIndexAndFilterBlocksWithHighPriority
+{
+	return _options.cache_index_and_filter_blocks_with_high_priority;
+}
+
+- (void)setPinL0FilterAndIndexBlocksInCache:(BOOL)pinL0FilterAndIndexBlocksInCache
+{
+	_options.pin_l0_filter_and_index_blocks_in_cache = pinL0FilterAndIndexBlocksInCache;
+}
+
+- (BOOL)pinL0FilterAndIndexBlocksInCache
+{
+	return _options.pin_l0_filter_and_index_blocks_in_cache;
+}
+
+- (void)setPinTopLevelIndexAndFilter:(BOOL)pinTopLevelIndexAndFilter
+{
+	_options.pin_top_level_index_and_filter = pinTopLevelIndexAndFilter;
+}
+
+- (BOOL)pinTopLevelIndexAndFilter
+{
+	return _options.pin_top_level_index_and_filter;
+}
+
 - (void)setIndexType:(BlockBasedTableIndexType)indexType
 {
 	_options.index_type = (rocksdb::BlockBasedTableOptions::IndexType)indexType;
@@ -77,6 +117,46 @@
 	return _options.hash_index_allow_collision;
 }
 
+- (void)setPartitionFilters:(BOOL)partitionFilters
+{
+	_options.partition_filters = partitionFilters;
+}
+
+- (BOOL)partitionFilters
+{
+	return _options.partition_filters;
+}
+
+- (void)setMetadataBlockSize:(uint64_t)metadataBlockSize
+{
+	_options.metadata_block_size = metadataBlockSize;
+}
+
+- (uint64_t)metadataBlockSize
+{
+	return _options.metadata_block_size;
+}
+
+- (void)setDataBlockIndexType:(BlockBasedTableDataBlockIndexType)dataBlockIndexType
+{
+	_options.data_block_index_type = (rocksdb::BlockBasedTableOptions::DataBlockIndexType)dataBlockIndexType;
+}
+
+- (BlockBasedTableDataBlockIndexType)dataBlockIndexType
+{
+	return (BlockBasedTableDataBlockIndexType)_options.data_block_index_type;
+}
+
+- (void)setDataBlockHashTableUtilRatio:(double)dataBlockHashTableUtilRatio
+{
+	_options.data_block_hash_table_util_ratio = dataBlockHashTableUtilRatio;
+}
+
+- (double)dataBlockHashTableUtilRatio
+{
+	return _options.data_block_hash_table_util_ratio;
+}
+
 - (void)setChecksumType:(BlockBasedTableChecksumType)checksumType
 {
 	_options.checksum = (rocksdb::ChecksumType)checksumType;
@@ -119,6 +199,19 @@
 	return _blockCacheCompressedWrapper;
 }
 
+#if !(defined(ROCKSDB_LITE) && defined(TARGET_OS_IPHONE))
+- (void)setPersistentCache:(RocksDBPersistentCache *)persistentCache
+{
+	_persistentCacheWrapper = persistentCache;
+	_options.persistent_cache = _persistentCacheWrapper.persistentCache;
+}
+
+- (RocksDBPersistentCache *)persistentCache
+{
+	return _persistentCacheWrapper;
+}
+#endif
+
 - (void)setBlockSize:(size_t)blockSize
 {
 	_options.block_size = blockSize;
@@ -152,7 +245,7 @@
 - (void)setFilterPolicy:(RocksDBFilterPolicy *)filterPolicy
 {
 	_filterPolicyWrapper = filterPolicy;
-	_options.filter_policy.reset(_filterPolicyWrapper.filterPolicy);
+	_options.filter_policy = _filterPolicyWrapper.filterPolicy;
 }
 
 - (RocksDBFilterPolicy *)filterPolicy
@@ -35,6 +35,70 @@ NS_ASSUME_NONNULL_BEGIN
  */
 + (instancetype)LRUCacheWithCapacity:(size_t)capacity numShardsBits:(int)numShardBits;
 
+/**
+ Create a new LRU cache with a fixed size capacity.
+
+ @discussion A part of the capacity can be reserved for high priority entries, e.g. index and filter blocks
+ when `cacheIndexAndFilterBlocksWithHighPriority` is set in the `RocksDBBlockBasedTableOptions`. Low priority
+ entries are evicted first, thus data blocks cannot push the high priority entries out of the cache.
+
+ @see capacity The cache capcity.
+ @see numShardBits The number of shard bits, or -1 to choose it automatically based on the capacity.
+ @see strictCapacityLimit Whether inserting into a full cache fails instead of exceeding the capacity.
+ @see highPriorityPoolRatio The ratio of the capacity reserved for high priority entries, between 0 and 1.
+ @return A new LRU cache, or nil if `numShardBits` is 20 or more or `highPriorityPoolRatio` is outside [0, 1].
+ */
++ (nullable instancetype)LRUCacheWithCapacity:(size_t)capacity
+					   numShardsBits:(int)numShardBits
+				 strictCapacityLimit:(BOOL)strictCapacityLimit
+			   highPriorityPoolRatio:(double)highPriorityPoolRatio;
+
+/**
+ Create a new clock cache with a fixed size capacity. The clock cache avoids the per-shard mutex of the
+ LRU cache on lookups, thus it scales better under highly concurrent reads.
+
+ @discussion The clock cache requires RocksDB to be built with `SUPPORT_CLOCK_CACHE` and Intel TBB. Neither
+ the Xcode project nor the podspec do so, thus the shipped builds always return nil.
+
+ @see capacity The cache capcity.
+ @return A new clock cache, or nil if RocksDB was built without clock cache support.
+ */
++ (nullable instancetype)clockCacheWithCapacity:(size_t)capacity;
+
+/**
+ Create a new clock cache with a fixed size capacity.
+
+ @discussion The clock cache requires RocksDB to be built with `SUPPORT_CLOCK_CACHE` and Intel TBB.
+
+ @see capacity The cache capcity.
+ @see numShardBits The number of shard bits, or -1 to choose it automatically based on the capacity.
+ @see strictCapacityLimit Whether inserting into a full cache fails instead of exceeding the capacity.
+ @return A new clock cache, or nil if RocksDB was built without clock cache support.
+ */
++ (nullable instancetype)clockCacheWithCapacity:(size_t)capacity
+								  numShardsBits:(int)numShardBits
+							strictCapacityLimit:(BOOL)strictCapacityLimit;
+
+/** @brief The name of the cache implementation, e.g. `LRUCache`. */
+@property (nonatomic, copy, readonly) NSString *name;
+
+/**
+ @brief The maximum configured capacity of the cache in bytes.
+
+ @discussion Setting a lower capacity evicts entries until the usage fits the new capacity, as far as
+ the entries aren't in use.
+ */
+@property (nonatomic, assign) size_t capacity;
+
+/** @brief Whether inserting into a full cache fails instead of exceeding the capacity. */
+@property (nonatomic, assign) BOOL strictCapacityLimit;
+
+/** @brief The memory size of all entries residing in the cache in bytes. */
+@property (nonatomic, assign, readonly) size_t usage;
+
+/** @brief The memory size of the entries which are currently in use, i.e. pinned, in bytes. */
+@property (nonatomic, assign, readonly) size_t pinnedUsage;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -30,6 +30,32 @@
 	return [[RocksDBCache alloc] initWithNativeCache:rocksdb::NewLRUCache(capacity, numShardBits)];
 }
 
++ (instancetype)LRUCacheWithCapacity:(size_t)capacity
+					   numShardsBits:(int)numShardBits
+				 strictCapacityLimit:(BOOL)strictCapacityLimit
+			   highPriorityPoolRatio:(double)highPriorityPoolRatio
+{
+	std::shared_ptr<rocksdb::Cache> cache = rocksdb::NewLRUCache(capacity, numShardBits, strictCapacityLimit, highPriorityPoolRatio);
+	if (cache == nullptr) {
+		return nil;
+	}
+	return [[RocksDBCache alloc] initWithNativeCache:cache];
+}
+
++ (instancetype)clockCacheWithCapacity:(size_t)capacity
+{
+	return [self clockCacheWithCapacity:capacity numShardsBits:-1 strictCapacityLimit:NO];
+}
+
++ (instancetype)clockCacheWithCapacity:(size_t)capacity numShardsBits:(int)numShardBits strictCapacityLimit:(BOOL)strictCapacityLimit
+{
+	std::shared_ptr<rocksdb::Cache> cache = rocksdb::NewClockCache(capacity, numShardBits, strictCapacityLimit);
+	if (cache == nullptr) {
+		return nil;
+	}
+	return [[RocksDBCache alloc] initWithNativeCache:cache];
+}
+
 - (instancetype)initWithNativeCache:(std::shared_ptr<rocksdb::Cache>)cache
 {
 	self = [super init];
@@ -48,4 +74,41 @@
 	}
 }
 
+#pragma mark - Accessor
+
+- (NSString *)name
+{
+	return @(_cache->Name());
+}
+
+- (size_t)capacity
+{
+	return _cache->GetCapacity();
+}
+
+- (void)setCapacity:(size_t)capacity
+{
+	_cache->SetCapacity(capacity);
+}
+
+- (BOOL)strictCapacityLimit
+{
+	return _cache->HasStrictCapacityLimit();
+}
+
+- (void)setStrictCapacityLimit:(BOOL)strictCapacityLimit
+{
+	_cache->SetStrictCapacityLimit(strictCapacityLimit);
+}
+
+- (size_t)usage
+{
+	return _cache->GetUsage();
+}
+
+- (size_t)pinnedUsage
+{
+	return _cache->GetPinnedUsage();
+}
+
 @end
@@ -0,0 +1,43 @@
+//
+//  RocksDBCallbackCompactionFilter.cpp
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#import "RocksDBCallbackCompactionFilter.h"
+
+class RocksDBCallbackCompactionFilterImpl : public rocksdb::CompactionFilter
+{
+private:
+	void* instance;
+	const char* name;
+	CompactionFilterCallback callback;
+
+public:
+	RocksDBCallbackCompactionFilterImpl(void* instance,
+										const char* name,
+										CompactionFilterCallback callback): instance(instance), name(name), callback(callback) {}
+
+	virtual const char* Name() const
+	{
+		return name;
+	}
+
+	virtual bool Filter(int level,
+						const rocksdb::Slice& key,
+						const rocksdb::Slice& existing_value,
+						std::string* new_value,
+						bool* value_changed) const
+	{
+		return callback(instance, level, key, existing_value);
+	}
+};
+
+rocksdb::CompactionFilter* RocksDBCallbackCompactionFilter(void* instance,
+														   const char* name,
+														   CompactionFilterCallback callback)
+{
+	return new RocksDBCallbackCompactionFilterImpl(instance, name, callback);
+}
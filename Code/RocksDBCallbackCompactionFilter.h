@@ -0,0 +1,24 @@
+//
+//  RocksDBCallbackCompactionFilter.h
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#ifndef __ObjectiveRocks__RocksDBCallbackCompactionFilter__
+#define __ObjectiveRocks__RocksDBCallbackCompactionFilter__
+
+#import <rocksdb/slice.h>
+#import <rocksdb/compaction_filter.h>
+
+typedef bool (* CompactionFilterCallback)(void* instance,
+										  int level,
+										  const rocksdb::Slice& key,
+										  const rocksdb::Slice& existing_value);
+
+extern rocksdb::CompactionFilter* RocksDBCallbackCompactionFilter(void* instance,
+																  const char* name,
+																  CompactionFilterCallback callback);
+
+#endif /* defined(__ObjectiveRocks__RocksDBCallbackCompactionFilter__) */
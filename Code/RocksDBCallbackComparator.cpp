@@ -14,11 +14,16 @@ private:
 	void* instance;
 	const char* name;
 	CompareCallback callback;
+	FindShortestSeparatorCallback separatorCallback;
+	FindShortSuccessorCallback successorCallback;
 
 public:
 	RocksDBCallbackComparatorImpl(void* instance,
 								  const char* name,
-								  CompareCallback callback): instance(instance), name(name), callback(callback) {}
+								  CompareCallback callback,
+								  FindShortestSeparatorCallback separatorCallback,
+								  FindShortSuccessorCallback successorCallback):
+		instance(instance), name(name), callback(callback), separatorCallback(separatorCallback), successorCallback(successorCallback) {}
 
 	virtual const char* Name() const
 	{
@@ -31,11 +36,25 @@ public:
 	}
 
 	virtual void FindShortestSeparator(std::string* start,
-									   const rocksdb::Slice& limit) const {}
+									   const rocksdb::Slice& limit) const
+	{
+		if (separatorCallback != nullptr) {
+			separatorCallback(instance, start, limit);
+		}
+	}
 
-	virtual void FindShortSuccessor(std::string* key) const {}
+	virtual void FindShortSuccessor(std::string* key) const
+	{
+		if (successorCallback != nullptr) {
+			successorCallback(instance, key);
+		}
+	}
 };
 
-const rocksdb::Comparator* RocksDBCallbackComparator(void* instance, const char* name, CompareCallback callback) {
-	return new RocksDBCallbackComparatorImpl(instance, name, callback);
+const rocksdb::Comparator* RocksDBCallbackComparator(void* instance,
+													 const char* name,
+													 CompareCallback callback,
+													 FindShortestSeparatorCallback separatorCallback,
+													 FindShortSuccessorCallback successorCallback) {
+	return new RocksDBCallbackComparatorImpl(instance, name, callback, separatorCallback, successorCallback);
 }
@@ -9,11 +9,20 @@
 #ifndef __ObjectiveRocks__RocksDBCallbackComparator__
 #define __ObjectiveRocks__RocksDBCallbackComparator__
 
+#import <string>
 #import <rocksdb/comparator.h>
 #import <rocksdb/slice.h>
 
 typedef int (* CompareCallback)(void* instance, const rocksdb::Slice& a, const rocksdb::Slice& b);
 
-extern const rocksdb::Comparator* RocksDBCallbackComparator(void* instance, const char* name, CompareCallback callback);
+typedef void (* FindShortestSeparatorCallback)(void* instance, std::string* start, const rocksdb::Slice& limit);
+
+typedef void (* FindShortSuccessorCallback)(void* instance, std::string* key);
+
+extern const rocksdb::Comparator* RocksDBCallbackComparator(void* instance,
+															const char* name,
+															CompareCallback callback,
+															FindShortestSeparatorCallback separatorCallback,
+															FindShortSuccessorCallback successorCallback);
 
 #endif /* defined(__ObjectiveRocks__RocksDBCallbackComparator__) */
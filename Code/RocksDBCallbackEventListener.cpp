@@ -0,0 +1,70 @@
+//
+//  RocksDBCallbackEventListener.cpp
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#include "RocksDBCallbackEventListener.h"
+
+class RocksDBCallbackEventListenerImpl : public rocksdb::EventListener
+{
+private:
+	void* instance;
+	FlushCompletedCallback flushCompletedCallback;
+	CompactionCompletedCallback compactionCompletedCallback;
+	StallConditionsChangedCallback stallConditionsChangedCallback;
+	TableFileCreatedCallback tableFileCreatedCallback;
+	TableFileDeletedCallback tableFileDeletedCallback;
+
+public:
+	RocksDBCallbackEventListenerImpl(void* instance,
+									 FlushCompletedCallback flushCompleted,
+									 CompactionCompletedCallback compactionCompleted,
+									 StallConditionsChangedCallback stallConditionsChanged,
+									 TableFileCreatedCallback tableFileCreated,
+									 TableFileDeletedCallback tableFileDeleted):
+	instance(instance),
+	flushCompletedCallback(flushCompleted),
+	compactionCompletedCallback(compactionCompleted),
+	stallConditionsChangedCallback(stallConditionsChanged),
+	tableFileCreatedCallback(tableFileCreated),
+	tableFileDeletedCallback(tableFileDeleted) {}
+
+	virtual void OnFlushCompleted(rocksdb::DB* db, const rocksdb::FlushJobInfo& info)
+	{
+		flushCompletedCallback(instance, info);
+	}
+
+	virtual void OnCompactionCompleted(rocksdb::DB* db, const rocksdb::CompactionJobInfo& info)
+	{
+		compactionCompletedCallback(instance, info);
+	}
+
+	virtual void OnStallConditionsChanged(const rocksdb::WriteStallInfo& info)
+	{
+		stallConditionsChangedCallback(instance, info);
+	}
+
+	virtual void OnTableFileCreated(const rocksdb::TableFileCreationInfo& info)
+	{
+		tableFileCreatedCallback(instance, info);
+	}
+
+	virtual void OnTableFileDeleted(const rocksdb::TableFileDeletionInfo& info)
+	{
+		tableFileDeletedCallback(instance, info);
+	}
+};
+
+rocksdb::EventListener* RocksDBCallbackEventListener(void* instance,
+													 FlushCompletedCallback flushCompleted,
+													 CompactionCompletedCallback compactionCompleted,
+													 StallConditionsChangedCallback stallConditionsChanged,
+													 TableFileCreatedCallback tableFileCreated,
+													 TableFileDeletedCallback tableFileDeleted)
+{
+	return new RocksDBCallbackEventListenerImpl(instance, flushCompleted, compactionCompleted,
+												stallConditionsChanged, tableFileCreated, tableFileDeleted);
+}
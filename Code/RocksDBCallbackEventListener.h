@@ -0,0 +1,27 @@
+//
+//  RocksDBCallbackEventListener.h
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#ifndef __ObjectiveRocks__RocksDBCallbackEventListener__
+#define __ObjectiveRocks__RocksDBCallbackEventListener__
+
+#import <rocksdb/listener.h>
+
+typedef void (* FlushCompletedCallback)(void* instance, const rocksdb::FlushJobInfo& info);
+typedef void (* CompactionCompletedCallback)(void* instance, const rocksdb::CompactionJobInfo& info);
+typedef void (* StallConditionsChangedCallback)(void* instance, const rocksdb::WriteStallInfo& info);
+typedef void (* TableFileCreatedCallback)(void* instance, const rocksdb::TableFileCreationInfo& info);
+typedef void (* TableFileDeletedCallback)(void* instance, const rocksdb::TableFileDeletionInfo& info);
+
+extern rocksdb::EventListener* RocksDBCallbackEventListener(void* instance,
+															FlushCompletedCallback flushCompleted,
+															CompactionCompletedCallback compactionCompleted,
+															StallConditionsChangedCallback stallConditionsChanged,
+															TableFileCreatedCallback tableFileCreated,
+															TableFileDeletedCallback tableFileDeleted);
+
+#endif /* defined(__ObjectiveRocks__RocksDBCallbackEventListener__) */
@@ -15,25 +15,32 @@ private:
 	const char* name;
 	PartialMergeCallback partialMergeCallback;
 	FullMergeCallback fullMergeCallback;
+	ShouldMergeCallback shouldMergeCallback;
+	bool allowSingleOperand;
 public:
 	RocksDBCallbackMergeOperatorImpl(void* instance,
 									 const char* name,
 									 PartialMergeCallback partialMergeCallback,
-									 FullMergeCallback fullMergeCallback):
-	instance(instance), name(name), partialMergeCallback(partialMergeCallback), fullMergeCallback(fullMergeCallback) {}
+									 FullMergeCallback fullMergeCallback,
+									 ShouldMergeCallback shouldMergeCallback,
+									 bool allowSingleOperand):
+	instance(instance), name(name), partialMergeCallback(partialMergeCallback), fullMergeCallback(fullMergeCallback),
+	shouldMergeCallback(shouldMergeCallback), allowSingleOperand(allowSingleOperand) {}
 
 	const char* Name() const
 	{
 		return name;
 	}
 
-	virtual bool FullMerge(const rocksdb::Slice& key,
-				   const rocksdb::Slice* existing_value,
-				   const std::deque<std::string>& operand_list,
-				   std::string* new_value,
-				   rocksdb::Logger* logger) const
+	virtual bool FullMergeV2(const rocksdb::MergeOperator::MergeOperationInput& merge_in,
+							 rocksdb::MergeOperator::MergeOperationOutput* merge_out) const
 	{
-		return fullMergeCallback(instance, key, existing_value, operand_list, new_value, logger);
+		return fullMergeCallback(instance,
+								 merge_in.key,
+								 merge_in.existing_value,
+								 merge_in.operand_list,
+								 &merge_out->new_value,
+								 merge_in.logger);
 	}
 
 	virtual bool PartialMerge(const rocksdb::Slice& key,
@@ -44,13 +51,39 @@ public:
 	{
 		return partialMergeCallback(instance, key, left_operand, right_operand, new_value, logger);
 	}
+
+	virtual bool PartialMergeMulti(const rocksdb::Slice& key,
+								   const std::deque<rocksdb::Slice>& operand_list,
+								   std::string* new_value,
+								   rocksdb::Logger* logger) const
+	{
+		// Only called with a single operand if AllowSingleOperand() is true, in which case the base
+		// implementation would return true without touching new_value, i.e. an empty operand
+		if (operand_list.size() == 1) {
+			return partialMergeCallback(instance, key, rocksdb::Slice(), operand_list.front(), new_value, logger);
+		}
+		return rocksdb::MergeOperator::PartialMergeMulti(key, operand_list, new_value, logger);
+	}
+
+	virtual bool AllowSingleOperand() const
+	{
+		return allowSingleOperand;
+	}
+
+	virtual bool ShouldMerge(const std::vector<rocksdb::Slice>& operands) const
+	{
+		return shouldMergeCallback != nullptr && shouldMergeCallback(instance, operands);
+	}
 };
 
 rocksdb::MergeOperator* RocksDBCallbackMergeOperator(void* instance,
 													 const char* name,
 													 PartialMergeCallback partialMergeCallback,
-													 FullMergeCallback fullMergeCallback)
+													 FullMergeCallback fullMergeCallback,
+													 ShouldMergeCallback shouldMergeCallback,
+													 bool allowSingleOperand)
 {
-	return new RocksDBCallbackMergeOperatorImpl(instance, name, partialMergeCallback, fullMergeCallback);
+	return new RocksDBCallbackMergeOperatorImpl(instance, name, partialMergeCallback, fullMergeCallback,
+												shouldMergeCallback, allowSingleOperand);
 }
 
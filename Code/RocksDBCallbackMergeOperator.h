@@ -9,7 +9,9 @@
 #ifndef __ObjectiveRocks__RocksDBCallbackMergeOperator__
 #define __ObjectiveRocks__RocksDBCallbackMergeOperator__
 
+#import <deque>
 #import <string>
+#import <vector>
 #import <rocksdb/slice.h>
 #import <rocksdb/env.h>
 #import <rocksdb/merge_operator.h>
@@ -24,13 +26,18 @@ typedef bool (* PartialMergeCallback)(void* instance,
 typedef bool (* FullMergeCallback)(void* instance,
 								   const rocksdb::Slice& key,
 								   const rocksdb::Slice* existing_value,
-								   const std::deque<std::string>& operand_list,
+								   const std::vector<rocksdb::Slice>& operand_list,
 								   std::string* new_value,
 								   rocksdb::Logger* logger);
 
+typedef bool (* ShouldMergeCallback)(void* instance,
+									 const std::vector<rocksdb::Slice>& operands);
+
 extern rocksdb::MergeOperator* RocksDBCallbackMergeOperator(void* instance,
 															const char* name,
 															PartialMergeCallback partialMergeCallback,
-															FullMergeCallback fullMergeCallback);
+															FullMergeCallback fullMergeCallback,
+															ShouldMergeCallback shouldMergeCallback,
+															bool allowSingleOperand);
 
 #endif /* defined(__ObjectiveRocks__RocksDBCallbackMergeOperator__) */
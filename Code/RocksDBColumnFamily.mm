@@ -29,6 +29,10 @@
 
 - (void)close
 {
+#if !(defined(ROCKSDB_LITE) && defined(TARGET_OS_IPHONE))
+	[self cancelBlockCacheWarmUp];
+#endif
+
 	@synchronized(self) {
 		if (self.columnFamily != nullptr) {
 			delete self.columnFamily;
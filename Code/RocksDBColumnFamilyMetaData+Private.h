@@ -8,6 +8,8 @@
 
 #import "RocksDBColumnFamilyMetadata.h"
 
+#include <vector>
+
 namespace rocksdb {
 	class ColumnFamilyMetaData;
 	class LevelMetaData;
@@ -22,9 +24,10 @@ namespace rocksdb {
 
 /**
  Initializes a new instance of `RocksDBColumnFamilyMetaData` with the given
- rocksdb::ColumnFamilyMetaData
+ rocksdb::ColumnFamilyMetaData and the compression ratio of each level
  */
-- (instancetype)initWithMetaData:(rocksdb::ColumnFamilyMetaData)metadata;
+- (instancetype)initWithMetaData:(rocksdb::ColumnFamilyMetaData)metadata
+			   compressionRatios:(const std::vector<double> &)compressionRatios;
 
 @end
 
@@ -36,9 +39,9 @@ namespace rocksdb {
 
 /**
  Initializes a new instance of `RocksDBLevelFileMetaData` with the given
- rocksdb::LevelMetaData
+ rocksdb::LevelMetaData and compression ratio
  */
-- (instancetype)initWithLevelMetaData:(rocksdb::LevelMetaData)metadata;
+- (instancetype)initWithLevelMetaData:(rocksdb::LevelMetaData)metadata compressionRatio:(double)compressionRatio;
 
 @end
 
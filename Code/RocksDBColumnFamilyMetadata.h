@@ -56,6 +56,12 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (nonatomic, readonly) uint64_t size;
 
+/**
+ @brief The estimated compression ratio of this level, i.e. the raw size of its keys and values
+ divided by the size of its files, or -1 if the level has no files.
+ */
+@property (nonatomic, readonly) double compressionRatio;
+
 /**
  @brief The metadata of all sst files in this level.
  */
@@ -14,6 +14,7 @@
 @implementation RocksDBColumnFamilyMetaData
 
 - (instancetype)initWithMetaData:(rocksdb::ColumnFamilyMetaData)metadata
+			   compressionRatios:(const std::vector<double> &)compressionRatios
 {
 	self = [super init];
 	if (self) {
@@ -22,7 +23,10 @@
 		self->_name = [NSString stringWithCString:metadata.name.c_str() encoding:NSUTF8StringEncoding];
 		NSMutableArray *levels = [NSMutableArray array];
 		for (auto it = std::begin(metadata.levels); it != std::end(metadata.levels); ++it) {
-			RocksDBLevelFileMetaData *levelMetaData = [[RocksDBLevelFileMetaData alloc] initWithLevelMetaData:*it];
+			size_t level = static_cast<size_t>(it - std::begin(metadata.levels));
+			double compressionRatio = level < compressionRatios.size() ? compressionRatios[level] : -1.0;
+			RocksDBLevelFileMetaData *levelMetaData = [[RocksDBLevelFileMetaData alloc] initWithLevelMetaData:*it
+																					  compressionRatio:compressionRatio];
 			[levels addObject:levelMetaData];
 		}
 		self->_levels = levels;
@@ -34,12 +38,13 @@
 
 @implementation RocksDBLevelFileMetaData
 
-- (instancetype)initWithLevelMetaData:(rocksdb::LevelMetaData)metadata
+- (instancetype)initWithLevelMetaData:(rocksdb::LevelMetaData)metadata compressionRatio:(double)compressionRatio
 {
 	self = [super init];
 	if (self) {
 		self->_level = metadata.level;
 		self->_size = metadata.size;
+		self->_compressionRatio = compressionRatio;
 
 		NSMutableArray *sstFiles = [NSMutableArray array];
 		for (auto it = std::begin(metadata.files); it != std::end(metadata.files); ++it) {
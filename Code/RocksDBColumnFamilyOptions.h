@@ -12,7 +12,9 @@
 @class RocksDBTableFactory;
 @class RocksDBComparator;
 @class RocksDBMergeOperator;
+@class RocksDBCompactionFilter;
 @class RocksDBPrefixExtractor;
+@class RocksDBCompressionOptions;
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -24,7 +26,11 @@ typedef NS_ENUM(char, RocksDBCompressionType)
 	RocksDBCompressionZlib = 0x2,
 	RocksDBCompressionBZip2 = 0x3,
 	RocksDBCompressionLZ4 = 0x4,
-	RocksDBCompressionLZ4HC = 0x5
+	RocksDBCompressionLZ4HC = 0x5,
+	RocksDBCompressionXpress = 0x6,
+	RocksDBCompressionZSTD = 0x7,
+	/** Only valid for `bottommostCompressionType`, where it disables the bottommost override. */
+	RocksDBCompressionDisabled = (char)0xFF
 };
 
 @interface RocksDBColumnFamilyOptions : NSObject
@@ -48,6 +54,14 @@ typedef NS_ENUM(char, RocksDBCompressionType)
  */
 @property (nonatomic, strong, nullable) RocksDBMergeOperator *mergeOperator;
 
+/** @brief A single compaction filter, which is consulted for every entry during
+ compaction and can remove it, e.g. expired records.
+ Default: nil
+
+ @see RocksDBCompactionFilter
+ */
+@property (nonatomic, strong, nullable) RocksDBCompactionFilter *compactionFilter;
+
 /** @brief Amount of data to build up in memory (backed by an unsorted log
  on disk) before converting to a sorted on-disk file.
  Default: 4MB.
@@ -70,6 +84,33 @@ typedef NS_ENUM(char, RocksDBCompressionType)
  */
 @property (nonatomic, assign) RocksDBCompressionType compressionType;
 
+/** @brief Different compression algorithms for the different levels, as an array of
+ `RocksDBCompressionType` values. If non-empty, it overrides `compressionType` and must
+ have one entry per level, e.g. no compression for L0 and L1, LZ4 for the middle levels
+ and zstd for the larger ones. A shorter array is padded with its last entry.
+ Default: empty
+ */
+@property (nonatomic, copy) NSArray<NSNumber *> *compressionPerLevel;
+
+/** @brief Options for the compression algorithm, e.g. the zstd level and dictionary size.
+
+ @see RocksDBCompressionOptions
+ */
+@property (nonatomic, strong, nullable) RocksDBCompressionOptions *compressionOptions;
+
+/** @brief Compression algorithm for the bottommost level, which holds most of the data and
+ is rewritten least often, thus favoring a stronger algorithm than the other levels.
+ Default: RocksDBCompressionDisabled, i.e. the bottommost level is compressed like the others.
+ */
+@property (nonatomic, assign) RocksDBCompressionType bottommostCompressionType;
+
+/** @brief Options for the bottommost compression algorithm. Only used if `enabled` is set,
+ otherwise `compressionOptions` applies to the bottommost level as well.
+
+ @see RocksDBCompressionOptions
+ */
+@property (nonatomic, strong, nullable) RocksDBCompressionOptions *bottommostCompressionOptions;
+
 /** @brief If non-nil, the specified function to determine the
  prefixes for keys will be used. These prefixes will be placed in the filter.
 
@@ -170,6 +211,8 @@ typedef NS_ENUM(char, RocksDBCompressionType)
 @property (nonatomic, assign) uint32_t bloomLocality;
 
 /** @brief Maximum number of successive merge operations on a key in the memtable.
+ When reached, the merge operands are folded into a single value on write, which bounds
+ the length of the operand chains that have to be merged on read.
  Default: 0 (disabled)
  */
 @property (nonatomic, assign) size_t maxSuccessiveMerges;
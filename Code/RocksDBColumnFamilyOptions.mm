@@ -12,11 +12,14 @@
 #import "RocksDBTableFactory.h"
 #import "RocksDBComparator.h"
 #import "RocksDBMergeOperator.h"
+#import "RocksDBCompactionFilter.h"
 #import "RocksDBPrefixExtractor.h"
+#import "RocksDBCompressionOptions.h"
 
 #import <rocksdb/options.h>
 #import <rocksdb/comparator.h>
 #import <rocksdb/merge_operator.h>
+#import <rocksdb/compaction_filter.h>
 #import <rocksdb/slice_transform.h>
 #import <rocksdb/memtablerep.h>
 #import <rocksdb/table.h>
@@ -31,10 +34,18 @@
 @property (nonatomic, assign) rocksdb::MergeOperator *mergeOperator;
 @end
 
+@interface RocksDBCompactionFilter ()
+@property (nonatomic, assign) const rocksdb::CompactionFilter *compactionFilter;
+@end
+
 @interface RocksDBPrefixExtractor ()
 @property (nonatomic, assign) const rocksdb::SliceTransform *sliceTransform;
 @end
 
+@interface RocksDBCompressionOptions ()
+@property (nonatomic, assign) rocksdb::CompressionOptions options;
+@end
+
 @interface RocksDBMemTableRepFactory ()
 @property (nonatomic, assign) rocksdb::MemTableRepFactory *memTableRepFactory;
 @end
@@ -49,7 +60,10 @@
 
 	RocksDBComparator *_comparatorWrapper;
 	RocksDBMergeOperator *_mergeOperatorWrapper;
+	RocksDBCompactionFilter *_compactionFilterWrapper;
 	RocksDBPrefixExtractor *_prefixExtractorWrapper;
+	RocksDBCompressionOptions *_compressionOptionsWrapper;
+	RocksDBCompressionOptions *_bottommostCompressionOptionsWrapper;
 
 	RocksDBMemTableRepFactory *_memTableRepFactoryWrapper;
 	RocksDBTableFactory *_tableFactoryWrapper;
@@ -95,6 +109,17 @@
 	return _mergeOperatorWrapper;
 }
 
+- (void)setCompactionFilter:(RocksDBCompactionFilter *)compactionFilter
+{
+	_compactionFilterWrapper = compactionFilter;
+	_options.compaction_filter = _compactionFilterWrapper.compactionFilter;
+}
+
+- (RocksDBCompactionFilter *)compactionFilter
+{
+	return _compactionFilterWrapper;
+}
+
 - (size_t)writeBufferSize
 {
 	return _options.write_buffer_size;
@@ -135,6 +160,55 @@
 	_options.compression = (rocksdb::CompressionType)compressionType;
 }
 
+- (NSArray<NSNumber *> *)compressionPerLevel
+{
+	NSMutableArray *compressionPerLevel = [NSMutableArray arrayWithCapacity:_options.compression_per_level.size()];
+	for (auto compressionType : _options.compression_per_level) {
+		[compressionPerLevel addObject:@((RocksDBCompressionType)compressionType)];
+	}
+	return compressionPerLevel;
+}
+
+- (void)setCompressionPerLevel:(NSArray<NSNumber *> *)compressionPerLevel
+{
+	_options.compression_per_level.clear();
+	for (NSNumber *compressionType in compressionPerLevel) {
+		_options.compression_per_level.push_back((rocksdb::CompressionType)compressionType.charValue);
+	}
+}
+
+- (void)setCompressionOptions:(RocksDBCompressionOptions *)compressionOptions
+{
+	_compressionOptionsWrapper = compressionOptions;
+	_options.compression_opts = _compressionOptionsWrapper ? _compressionOptionsWrapper.options : rocksdb::CompressionOptions();
+}
+
+- (RocksDBCompressionOptions *)compressionOptions
+{
+	return _compressionOptionsWrapper;
+}
+
+- (RocksDBCompressionType)bottommostCompressionType
+{
+	return (RocksDBCompressionType)_options.bottommost_compression;
+}
+
+- (void)setBottommostCompressionType:(RocksDBCompressionType)bottommostCompressionType
+{
+	_options.bottommost_compression = (rocksdb::CompressionType)bottommostCompressionType;
+}
+
+- (void)setBottommostCompressionOptions:(RocksDBCompressionOptions *)bottommostCompressionOptions
+{
+	_bottommostCompressionOptionsWrapper = bottommostCompressionOptions;
+	_options.bottommost_compression_opts = _bottommostCompressionOptionsWrapper ? _bottommostCompressionOptionsWrapper.options : rocksdb::CompressionOptions();
+}
+
+- (RocksDBCompressionOptions *)bottommostCompressionOptions
+{
+	return _bottommostCompressionOptionsWrapper;
+}
+
 - (void)setPrefixExtractor:(RocksDBPrefixExtractor *)prefixExtractor
 {
 	_prefixExtractorWrapper = prefixExtractor;
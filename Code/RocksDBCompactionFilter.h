@@ -0,0 +1,83 @@
+//
+//  RocksDBCompactionFilter.h
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ A Compaction Filter is consulted for every key-value pair during compaction and can remove
+ entries from the database, e.g. expired records, without an explicit delete.
+
+ @warning A compaction filter may be called concurrently from multiple background threads.
+ */
+@interface RocksDBCompactionFilter : NSObject
+
+/** @brief The name of this compaction filter. */
+@property (nonatomic, readonly) NSString *name;
+
+/**
+ Initializes a new instance of a native compaction filter, which removes entries older than
+ the given time to live.
+
+ @discussion The values must carry a timestamp suffix, i.e. 64-bit seconds since the Unix epoch,
+ little-endian encoded, appended to the value. Values without a timestamp suffix are kept.
+
+ Values with a timestamp in the future are kept as well.
+
+ @param ttl The time to live of the entries in seconds, a finite and non-negative interval.
+ @return A newly-initialized instance of the Compaction Filter, or nil if the `ttl` is negative or not finite.
+
+ @see dataByAppendingTimestamp:toData:
+ @see dataByRemovingTimestampFromData:
+ */
++ (nullable instancetype)timeToLiveFilterWithInterval:(NSTimeInterval)ttl;
+
+/**
+ Initializes a new instance of a native compaction filter, which removes entries whose keys
+ start with any of the given prefixes.
+
+ @param prefixes The key prefixes to drop.
+ @return A newly-initialized instance of the Compaction Filter.
+ */
++ (instancetype)prefixDropFilterWithPrefixes:(NSArray<NSData *> *)prefixes;
+
+/**
+ Initializes a new instance of a compaction filter with the given name and block.
+
+ @discussion The key and value passed to the block are not copied and are valid only for the
+ duration of the block, in order to keep the cost of crossing into Objective-C low. Use
+ `+[NSData dataWithData:]` to retain them.
+
+ @param name The name of the compaction filter.
+ @param block The block to apply on each entry. Returning `YES` removes the entry.
+ @return A newly-initialized instance of the Compaction Filter.
+ */
++ (instancetype)filterWithName:(NSString *)name
+					  andBlock:(BOOL (^)(int level, NSData *key, NSData *value))block;
+
+/**
+ Appends the given date as a timestamp suffix to the value, as expected by the time to live filter.
+
+ @param date The timestamp to append.
+ @param data The value data.
+ @return The value with the timestamp suffix.
+ */
++ (NSData *)dataByAppendingTimestamp:(NSDate *)date toData:(NSData *)data;
+
+/**
+ Removes the timestamp suffix from the value.
+
+ @param data The value data with a timestamp suffix.
+ @return The value without the timestamp suffix, `nil` if the data is too short.
+ */
++ (nullable NSData *)dataByRemovingTimestampFromData:(NSData *)data;
+
+@end
+
+NS_ASSUME_NONNULL_END
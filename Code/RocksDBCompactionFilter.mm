@@ -0,0 +1,127 @@
+//
+//  RocksDBCompactionFilter.mm
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#import "RocksDBCompactionFilter.h"
+#import "RocksDBCallbackCompactionFilter.h"
+#import "RocksDBNativeCompactionFilter.h"
+
+#import <rocksdb/compaction_filter.h>
+#import <rocksdb/slice.h>
+
+#import <cmath>
+
+@interface RocksDBCompactionFilter ()
+{
+	NSString *_name;
+	BOOL (^_filterBlock)(int level, NSData *key, NSData *value);
+	const rocksdb::CompactionFilter *_compactionFilter;
+}
+@property (nonatomic, assign) const rocksdb::CompactionFilter *compactionFilter;
+@end
+
+@implementation RocksDBCompactionFilter
+@synthesize name = _name;
+@synthesize compactionFilter = _compactionFilter;
+
+#pragma mark - Compaction Filter Factory
+
++ (instancetype)timeToLiveFilterWithInterval:(NSTimeInterval)ttl
+{
+	if (!std::isfinite(ttl) || ttl < 0) {
+		return nil;
+	}
+
+	// Converting a double beyond the range of uint64_t is undefined
+	uint64_t seconds = ttl >= 18446744073709551616.0 ? UINT64_MAX : static_cast<uint64_t>(ttl);
+	return [[self alloc] initWithNativeCompactionFilter:RocksDBTimeToLiveCompactionFilter(seconds)];
+}
+
++ (instancetype)prefixDropFilterWithPrefixes:(NSArray<NSData *> *)prefixes
+{
+	std::vector<std::string> nativePrefixes;
+	nativePrefixes.reserve(prefixes.count);
+	for (NSData *prefix in prefixes) {
+		nativePrefixes.push_back(std::string((const char *)prefix.bytes, prefix.length));
+	}
+	return [[self alloc] initWithNativeCompactionFilter:RocksDBPrefixDropCompactionFilter(nativePrefixes)];
+}
+
++ (instancetype)filterWithName:(NSString *)name
+					  andBlock:(BOOL (^)(int level, NSData *key, NSData *value))block
+{
+	return [[self alloc] initWithName:name andBlock:block];
+}
+
+#pragma mark - Lifecycle
+
+- (instancetype)initWithName:(NSString *)name
+					andBlock:(BOOL (^)(int level, NSData *key, NSData *value))block
+{
+	self = [super init];
+	if (self) {
+		_name = [name copy];
+		_filterBlock = [block copy];
+		_compactionFilter = RocksDBCallbackCompactionFilter((__bridge void *)self, _name.UTF8String, &trampolineFilter);
+	}
+	return self;
+}
+
+- (instancetype)initWithNativeCompactionFilter:(rocksdb::CompactionFilter *)compactionFilter
+{
+	self = [super init];
+	if (self) {
+		_name = [NSString stringWithCString:compactionFilter->Name() encoding:NSUTF8StringEncoding];
+		_compactionFilter = compactionFilter;
+	}
+	return self;
+}
+
+- (void)dealloc
+{
+	@synchronized(self) {
+		if (_compactionFilter != nullptr) {
+			delete _compactionFilter;
+			_compactionFilter = nullptr;
+		}
+	}
+}
+
+#pragma mark - Callback
+
+bool trampolineFilter(void* instance, int level, const rocksdb::Slice& key, const rocksdb::Slice& existing_value)
+{
+	@autoreleasepool {
+		return [(__bridge id)instance filterLevel:level key:key value:existing_value];
+	}
+}
+
+- (BOOL)filterLevel:(int)level key:(const rocksdb::Slice &)key value:(const rocksdb::Slice &)value
+{
+	NSData *keyData = [NSData dataWithBytesNoCopy:(void *)key.data() length:key.size() freeWhenDone:NO];
+	NSData *valueData = [NSData dataWithBytesNoCopy:(void *)value.data() length:value.size() freeWhenDone:NO];
+	return _filterBlock ? _filterBlock(level, keyData, valueData) : NO;
+}
+
+#pragma mark - Timestamps
+
++ (NSData *)dataByAppendingTimestamp:(NSDate *)date toData:(NSData *)data
+{
+	std::string value((const char *)data.bytes, data.length);
+	RocksDBAppendTimestampSuffix(&value, (uint64_t)MAX(date.timeIntervalSince1970, 0));
+	return [NSData dataWithBytes:value.data() length:value.size()];
+}
+
++ (NSData *)dataByRemovingTimestampFromData:(NSData *)data
+{
+	if (data.length < RocksDBTimestampSuffixLength) {
+		return nil;
+	}
+	return [data subdataWithRange:NSMakeRange(0, data.length - RocksDBTimestampSuffixLength)];
+}
+
+@end
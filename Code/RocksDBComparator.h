@@ -26,8 +26,36 @@ typedef NS_ENUM(NSUInteger, RocksDBComparatorType)
 
 	/** @brief Orders NSString keys in descending order via the compare selector. */
 	RocksDBComparatorStringCompareDescending,
+
+	/** @brief Orders UTF-8 encoded keys by their Unicode code points, natively without decoding the keys. */
+	RocksDBComparatorUTF8CodePoint,
+
+	/** @brief Orders 8-byte keys as big-endian unsigned 64-bit integers. */
+	RocksDBComparatorUInt64BigEndian,
+
+	/** @brief Orders 8-byte keys as big-endian two's complement signed 64-bit integers. */
+	RocksDBComparatorInt64BigEndian,
+
+	/** @brief Orders 8-byte keys as big-endian IEEE 754 doubles, i.e. -NaN < -Inf < -0.0 < +0.0 < +Inf < +NaN. */
+	RocksDBComparatorDoubleBigEndian,
+
+	/** @brief Orders composite keys component-wise, where each component is prefixed with its
+	 32-bit big-endian length. Keys with fewer components sort first. */
+	RocksDBComparatorLengthPrefixed,
 };
 
+/**
+ A plain C comparison function, which works directly on the key bytes.
+
+ @param context The context passed to the comparator initializer.
+ @param key1 The bytes of the first key.
+ @param length1 The length of the first key.
+ @param key2 The bytes of the second key.
+ @param length2 The length of the second key.
+ @return A negative value, zero or a positive value if the first key is less than, equal to or greater than the second key.
+ */
+typedef int (* RocksDBCompareFunction)(void * _Nullable context, const char *key1, size_t length1, const char *key2, size_t length2);
+
 /**
  The keys are ordered within the key-value store according to a specified comparator function. The default ordering 
  function for keys orders the bytes lexicographically.
@@ -39,11 +67,24 @@ typedef NS_ENUM(NSUInteger, RocksDBComparatorType)
 /**
  Intializes a new Comparator instance for the given built-in type.
 
+ @discussion The `StringCompare` comparators call back into Objective-C and decode both keys on every
+ comparison. All other built-in comparators are implemented natively. The fixed width comparators sort
+ keys of a different length after all 8-byte keys. The native comparators also shorten the keys stored in
+ the index blocks where their encoding allows it, i.e. except for the fixed width ones.
+
  @param type The comparator type.
  @return a newly-initialized instance of a keys comparator.
  */
 + (instancetype)comaparatorWithType:(RocksDBComparatorType)type;
 
+/**
+ Encodes the given components as a composite key for the `RocksDBComparatorLengthPrefixed` comparator.
+
+ @param components The key components.
+ @return The composite key, where each component is prefixed with its 32-bit big-endian length.
+ */
++ (NSData *)lengthPrefixedKeyWithComponents:(NSArray<NSData *> *)components;
+
 /**
  Intializes a new Comparator instance with the given name and comparison block.
 
@@ -54,6 +95,49 @@ typedef NS_ENUM(NSUInteger, RocksDBComparatorType)
 - (instancetype)initWithName:(NSString *)name
 					andBlock:(int (^)(NSData *key1, NSData *key2))block;
 
+/**
+ Intializes a new Comparator instance with the given name, comparison block and optional blocks
+ for shortening the keys stored in the index blocks.
+
+ @discussion Without the separator and successor blocks the full keys are stored in the index blocks,
+ which increases the index size, the cache footprint and the filter partitions.
+
+ * separatorBlock: given two keys `start` < `limit`, returns a short key in [start, limit), e.g. the
+ shortest prefix of `start` that still sorts before `limit` with its last byte incremented.
+
+ * successorBlock: returns a short key that sorts after or equal to the given key.
+
+ Returning `nil` from either block keeps the key unchanged. Results that are not shorter than the
+ original key or violate the ordering contract are ignored.
+
+ @param name The name of the comparator.
+ @param comparatorBlock The comparator block to apply on the keys in order to specify their order.
+ @param separatorBlock The block to find a short separator between two keys.
+ @param successorBlock The block to find a short successor of a key.
+ @return a newly-initialized instance of a keys comparator.
+ */
+- (instancetype)initWithName:(NSString *)name
+			 comparatorBlock:(int (^)(NSData *key1, NSData *key2))comparatorBlock
+			  separatorBlock:(nullable NSData * _Nullable (^)(NSData *start, NSData *limit))separatorBlock
+			  successorBlock:(nullable NSData * _Nullable (^)(NSData *key))successorBlock;
+
+/**
+ Intializes a new Comparator instance with the given name and plain C comparison function.
+
+ @discussion The function is called directly from RocksDB, without any Objective-C message send,
+ `NSData` boxing or autorelease traffic, and should be used for performance-critical comparators.
+ It may be called concurrently from multiple threads. The context is neither retained nor freed
+ and must outlive the database.
+
+ @param name The name of the comparator.
+ @param context An arbitrary pointer passed to the function.
+ @param compareFunction The function to apply on the keys in order to specify their order.
+ @return a newly-initialized instance of a keys comparator.
+ */
+- (instancetype)initWithName:(NSString *)name
+					 context:(nullable void *)context
+			 compareFunction:(RocksDBCompareFunction)compareFunction;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -9,14 +9,24 @@
 #import "RocksDBComparator.h"
 #import "RocksDBSlice.h"
 #import "RocksDBCallbackComparator.h"
+#import "RocksDBNativeComparator.h"
 
 #import <rocksdb/comparator.h>
 #include <rocksdb/slice.h>
 
+struct RocksDBComparatorFunctions
+{
+	void *context;
+	RocksDBCompareFunction compare;
+};
+
 @interface RocksDBComparator ()
 {
 	NSString *_name;
+	RocksDBComparatorFunctions _functions;
 	int (^_comparatorBlock)(NSData *key1, NSData *key2);
+	NSData * (^_separatorBlock)(NSData *start, NSData *limit);
+	NSData * (^_successorBlock)(NSData *key);
 	const rocksdb::Comparator *_comparator;
 }
 @property (nonatomic, strong) NSString *name;
@@ -51,19 +61,71 @@
 				NSString *str2 = [[NSString alloc] initWithData:key2 encoding:NSUTF8StringEncoding];
 				return -1 * [str1 compare:str2];
 			}];
+
+		case RocksDBComparatorUTF8CodePoint:
+			return [[self alloc] initWithNativeComparator:RocksDBUTF8CodePointComparator()];
+
+		case RocksDBComparatorUInt64BigEndian:
+			return [[self alloc] initWithNativeComparator:RocksDBUInt64BigEndianComparator()];
+
+		case RocksDBComparatorInt64BigEndian:
+			return [[self alloc] initWithNativeComparator:RocksDBInt64BigEndianComparator()];
+
+		case RocksDBComparatorDoubleBigEndian:
+			return [[self alloc] initWithNativeComparator:RocksDBDoubleBigEndianComparator()];
+
+		case RocksDBComparatorLengthPrefixed:
+			return [[self alloc] initWithNativeComparator:RocksDBLengthPrefixedComparator()];
 	}
 }
 
++ (NSData *)lengthPrefixedKeyWithComponents:(NSArray<NSData *> *)components
+{
+	NSMutableData *key = [NSMutableData data];
+	for (NSData *component in components) {
+		uint32_t length = CFSwapInt32HostToBig((uint32_t)component.length);
+		[key appendBytes:&length length:sizeof(length)];
+		[key appendData:component];
+	}
+	return key;
+}
+
 #pragma mark - Lifecycle
 
 - (instancetype)initWithName:(NSString *)name
 					andBlock:(int (^)(NSData *key1, NSData *key2))block
+{
+	return [self initWithName:name comparatorBlock:block separatorBlock:nil successorBlock:nil];
+}
+
+- (instancetype)initWithName:(NSString *)name
+			 comparatorBlock:(int (^)(NSData *key1, NSData *key2))comparatorBlock
+			  separatorBlock:(NSData * (^)(NSData *start, NSData *limit))separatorBlock
+			  successorBlock:(NSData * (^)(NSData *key))successorBlock
+{
+	self = [super init];
+	if (self) {
+		_name = [name copy];
+		_comparatorBlock = [comparatorBlock copy];
+		_separatorBlock = [separatorBlock copy];
+		_successorBlock = [successorBlock copy];
+		_comparator = RocksDBCallbackComparator((__bridge void *)self, name.UTF8String, &trampoline,
+												separatorBlock ? &trampolineSeparator : nullptr,
+												successorBlock ? &trampolineSuccessor : nullptr);
+	}
+	return self;
+}
+
+- (instancetype)initWithName:(NSString *)name
+					 context:(void *)context
+			 compareFunction:(RocksDBCompareFunction)compareFunction
 {
 	self = [super init];
 	if (self) {
 		_name = [name copy];
-		_comparatorBlock = [block copy];
-		_comparator = RocksDBCallbackComparator((__bridge void *)self, name.UTF8String, &trampoline);
+		_functions.context = context;
+		_functions.compare = compareFunction;
+		_comparator = RocksDBCallbackComparator(&_functions, _name.UTF8String, &trampolineFunction, nullptr, nullptr);
 	}
 	return self;
 }
@@ -92,4 +154,57 @@ int trampoline(void* instance, const rocksdb::Slice& slice1, const rocksdb::Slic
 	return [(__bridge id)instance compare:slice1 with:slice2];
 }
 
+int trampolineFunction(void* functions, const rocksdb::Slice& slice1, const rocksdb::Slice& slice2)
+{
+	RocksDBComparatorFunctions *comparator = static_cast<RocksDBComparatorFunctions *>(functions);
+	return comparator->compare(comparator->context, slice1.data(), slice1.size(), slice2.data(), slice2.size());
+}
+
+- (void)findShortestSeparator:(std::string *)start limit:(const rocksdb::Slice &)limit
+{
+	NSData *startData = [NSData dataWithBytesNoCopy:(void *)start->data() length:start->size() freeWhenDone:NO];
+	NSData *limitData = [NSData dataWithBytesNoCopy:(void *)limit.data() length:limit.size() freeWhenDone:NO];
+
+	NSData *separator = _separatorBlock(startData, limitData);
+	if (separator == nil || separator.length >= start->size()) {
+		return;
+	}
+
+	// The separator must satisfy start <= separator < limit, or the index would be corrupted
+	if (_comparatorBlock(separator, startData) < 0 || _comparatorBlock(separator, limitData) >= 0) {
+		return;
+	}
+	start->assign((const char *)separator.bytes, separator.length);
+}
+
+void trampolineSeparator(void* instance, std::string* start, const rocksdb::Slice& limit)
+{
+	@autoreleasepool {
+		[(__bridge id)instance findShortestSeparator:start limit:limit];
+	}
+}
+
+- (void)findShortSuccessor:(std::string *)key
+{
+	NSData *keyData = [NSData dataWithBytesNoCopy:(void *)key->data() length:key->size() freeWhenDone:NO];
+
+	NSData *successor = _successorBlock(keyData);
+	if (successor == nil || successor.length >= key->size()) {
+		return;
+	}
+
+	// The successor must satisfy key <= successor
+	if (_comparatorBlock(successor, keyData) < 0) {
+		return;
+	}
+	key->assign((const char *)successor.bytes, successor.length);
+}
+
+void trampolineSuccessor(void* instance, std::string* key)
+{
+	@autoreleasepool {
+		[(__bridge id)instance findShortSuccessor:key];
+	}
+}
+
 @end
@@ -0,0 +1,71 @@
+//
+//  RocksDBCompressionOptions.h
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Options that tune the compression algorithm selected by the Column Family options.
+
+ @discussion The options are copied when assigned to the Column Family options, thus any
+ changes must be made beforehand.
+ */
+@interface RocksDBCompressionOptions : NSObject
+
+/**
+ @brief
+  The window bits parameter of the zlib compression.
+  Default: -14
+ */
+@property (nonatomic, assign) int windowBits;
+
+/**
+ @brief
+  The compression level, e.g. 1-22 for zstd. The meaning and the valid range depend on
+  the compression algorithm.
+  Default: 32767, which is the algorithm's default level.
+ */
+@property (nonatomic, assign) int level;
+
+/**
+ @brief
+  The strategy parameter of the zlib compression.
+  Default: 0
+ */
+@property (nonatomic, assign) int strategy;
+
+/**
+ @brief
+  Maximum size of the dictionary used to prime the compression of each data block.
+  The dictionary is sampled from the data of the table file's first output and stored in the
+  file, which improves the ratio of small blocks with repetitive content.
+  Default: 0 (disabled)
+ */
+@property (nonatomic, assign) uint32_t maxDictBytes;
+
+/**
+ @brief
+  Maximum size of the training data passed to zstd's dictionary trainer. When zero, the
+  sampled data is used as the dictionary as-is. Only applicable to zstd, requires
+  `maxDictBytes` to be non-zero and should be a multiple of it, e.g. 100x.
+  Default: 0 (no training)
+ */
+@property (nonatomic, assign) uint32_t zstdMaxTrainBytes;
+
+/**
+ @brief
+  Whether these options are in use. Only considered for the bottommost compression
+  options, which are otherwise ignored in favor of the general compression options.
+  Default: NO
+ */
+@property (nonatomic, assign) BOOL enabled;
+
+@end
+
+NS_ASSUME_NONNULL_END
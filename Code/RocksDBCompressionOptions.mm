@@ -0,0 +1,96 @@
+//
+//  RocksDBCompressionOptions.mm
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#import "RocksDBCompressionOptions.h"
+
+#import <rocksdb/options.h>
+
+@interface RocksDBCompressionOptions ()
+{
+	rocksdb::CompressionOptions _options;
+}
+@property (nonatomic, assign) rocksdb::CompressionOptions options;
+@end
+
+@implementation RocksDBCompressionOptions
+@synthesize options = _options;
+
+#pragma mark - Lifecycle
+
+- (instancetype)init
+{
+	self = [super init];
+	if (self) {
+		_options = rocksdb::CompressionOptions();
+	}
+	return self;
+}
+
+#pragma mark - Accessor
+
+- (void)setWindowBits:(int)windowBits
+{
+	_options.window_bits = windowBits;
+}
+
+- (int)windowBits
+{
+	return _options.window_bits;
+}
+
+- (void)setLevel:(int)level
+{
+	_options.level = level;
+}
+
+- (int)level
+{
+	return _options.level;
+}
+
+- (void)setStrategy:(int)strategy
+{
+	_options.strategy = strategy;
+}
+
+- (int)strategy
+{
+	return _options.strategy;
+}
+
+- (void)setMaxDictBytes:(uint32_t)maxDictBytes
+{
+	_options.max_dict_bytes = maxDictBytes;
+}
+
+- (uint32_t)maxDictBytes
+{
+	return _options.max_dict_bytes;
+}
+
+- (void)setZstdMaxTrainBytes:(uint32_t)zstdMaxTrainBytes
+{
+	_options.zstd_max_train_bytes = zstdMaxTrainBytes;
+}
+
+- (uint32_t)zstdMaxTrainBytes
+{
+	return _options.zstd_max_train_bytes;
+}
+
+- (void)setEnabled:(BOOL)enabled
+{
+	_options.enabled = enabled;
+}
+
+- (BOOL)enabled
+{
+	return _options.enabled;
+}
+
+@end
@@ -9,9 +9,12 @@
 #import <Foundation/Foundation.h>
 
 @class RocksDBEnv;
+@class RocksDBWriteBufferManager;
 
 #if !(defined(ROCKSDB_LITE) && defined(TARGET_OS_IPHONE))
 @class RocksDBStatistics;
+@class RocksDBEventListener;
+@class RocksDBCache;
 #endif
 
 NS_ASSUME_NONNULL_BEGIN
@@ -63,6 +66,14 @@ typedef NS_ENUM(unsigned char, RocksDBLogLevel)
  The default is 0. */
 @property (nonatomic, assign) uint64_t  maxWriteAheadLogSize;
 
+/** @brief If non-nil, the memtables' memory is accounted to the given manager, which
+ enforces a memory budget across all column families and database instances it is shared with.
+ The default is nil.
+
+ @see RocksDBWriteBufferManager
+ */
+@property (nonatomic, strong, nullable) RocksDBWriteBufferManager *writeBufferManager;
+
 #if !(defined(ROCKSDB_LITE) && defined(TARGET_OS_IPHONE))
 /** @brief If non-nil, metrics about database operations will be collected.
  Statistics objects should not be shared between DB instances.
@@ -71,12 +82,46 @@ typedef NS_ENUM(unsigned char, RocksDBLogLevel)
  @see RocksDBStatistics
  */
 @property (nonatomic, strong, nullable) RocksDBStatistics *statistics;
+/** @brief Listeners to be notified about flushes, compactions, write stalls and table files.
+ The default is nil.
+
+ @see RocksDBEventListener
+ */
+@property (nonatomic, copy, nullable) NSArray<RocksDBEventListener *> *listeners;
+/** @brief If non-nil, the values of point lookups are cached in the given cache, so that
+ lookups on hot keys don't search the memtables, index and data blocks. The lookups served by the
+ row cache are counted per Column Family, see `-[RocksDB rowCacheHitCount]`.
+ The default is nil.
+
+ @see RocksDBCache
+ */
+@property (nonatomic, strong, nullable) RocksDBCache *rowCache;
+/** @brief If non-nil, the block cache of the default Column Family is warmed up in the background
+ from the hot keys file at this path right after the database is opened, and the keys sampled since
+ `-[RocksDB startTrackingHotKeysWithCapacity:]` are dumped to it when the database is closed.
+ A missing file is ignored. Closing the database cancels a running warm-up.
+ Only keys tracked on the default Column Family's `RocksDB` instance are covered, keys tracked on a
+ `RocksDBColumnFamily` are not dumped and must be dumped and warmed up manually.
+ The default is nil.
+
+ @see -[RocksDB warmUpBlockCacheFromHotKeysFileAtPath:completion:]
+ */
+@property (nonatomic, copy, nullable) NSString *hotKeysFilePath;
 #endif
 
 /** @brief If true, then every store to stable storage will issue a fsync.
  The default is false. */
 @property (nonatomic, assign) BOOL useFSync;
 
+/** @brief If true, table files are read via mmap instead of read calls, which
+ avoids copying the data for datasets that fit in memory.
+ The default is false. */
+@property (nonatomic, assign) BOOL allowMmapReads;
+
+/** @brief If true, files are written via mmap instead of write calls.
+ The default is false. */
+@property (nonatomic, assign) BOOL allowMmapWrites;
+
 /** @brief Specify the maximal size of the info log file. If maxLogFileSize == 0,
  all logs will be written to one log file.
  The default is 0. */
@@ -95,6 +140,13 @@ typedef NS_ENUM(unsigned char, RocksDBLogLevel)
  The default is 0. */
 @property (nonatomic, assign) uint64_t bytesPerSync;
 
+/** @brief Maximum number of threads a single compaction job is split into, each of
+ them writing a disjoint key range of the output. Only compactions starting at L0 and
+ manual compactions are split, while automatic compactions into the lower levels,
+ including the bottommost one, always run in a single thread.
+ The default is 1 (no subcompactions). */
+@property (nonatomic, assign) uint32_t maxSubcompactions;
+
 @end
 
 NS_ASSUME_NONNULL_END
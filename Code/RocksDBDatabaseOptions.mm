@@ -9,21 +9,40 @@
 #import "RocksDBDatabaseOptions.h"
 
 #import "RocksDBEnv.h"
+#import "RocksDBWriteBufferManager.h"
 #import <rocksdb/options.h>
 
+@interface RocksDBWriteBufferManager ()
+@property (nonatomic, assign) std::shared_ptr<rocksdb::WriteBufferManager> writeBufferManager;
+@end
+
 #if !(defined(ROCKSDB_LITE) && defined(TARGET_OS_IPHONE))
 #import "RocksDBStatistics.h"
 @interface RocksDBStatistics ()
 @property (nonatomic, assign) std::shared_ptr<rocksdb::Statistics> statistics;
 @end
+
+#import "RocksDBEventListener.h"
+@interface RocksDBEventListener ()
+@property (nonatomic, assign) std::shared_ptr<rocksdb::EventListener> listener;
+@end
+
+#import "RocksDBCache.h"
+#import "RocksDBNativeRowCache.h"
+@interface RocksDBCache ()
+@property (nonatomic, assign) std::shared_ptr<rocksdb::Cache> cache;
+@end
 #endif
 
 @interface RocksDBDatabaseOptions ()
 {
 	rocksdb::DBOptions _options;
+	RocksDBWriteBufferManager *_writeBufferManagerWrapper;
 
 #if !(defined(ROCKSDB_LITE) && defined(TARGET_OS_IPHONE))
 	RocksDBStatistics *_statisticsWrapper;
+	NSArray<RocksDBEventListener *> *_listenerWrappers;
+	RocksDBCache *_rowCacheWrapper;
 #endif
 }
 @property (nonatomic, assign) const rocksdb::DBOptions options;
@@ -115,6 +134,17 @@
 	_options.max_total_wal_size	= maxWriteAheadLogSize;
 }
 
+- (RocksDBWriteBufferManager *)writeBufferManager
+{
+	return _writeBufferManagerWrapper;
+}
+
+- (void)setWriteBufferManager:(RocksDBWriteBufferManager *)writeBufferManager
+{
+	_writeBufferManagerWrapper = writeBufferManager;
+	_options.write_buffer_manager = _writeBufferManagerWrapper.writeBufferManager;
+}
+
 #if !(defined(ROCKSDB_LITE) && defined(TARGET_OS_IPHONE))
 - (RocksDBStatistics *)statistics
 {
@@ -126,6 +156,31 @@
 	_statisticsWrapper = statistics;
 	_options.statistics = _statisticsWrapper.statistics;
 }
+
+- (NSArray<RocksDBEventListener *> *)listeners
+{
+	return _listenerWrappers;
+}
+
+- (void)setListeners:(NSArray<RocksDBEventListener *> *)listeners
+{
+	_listenerWrappers = [listeners copy];
+	_options.listeners.clear();
+	for (RocksDBEventListener *listener in _listenerWrappers) {
+		_options.listeners.push_back(listener.listener);
+	}
+}
+
+- (RocksDBCache *)rowCache
+{
+	return _rowCacheWrapper;
+}
+
+- (void)setRowCache:(RocksDBCache *)rowCache
+{
+	_rowCacheWrapper = rowCache;
+	_options.row_cache = _rowCacheWrapper != nil ? RocksDBCountingRowCache(_rowCacheWrapper.cache) : nullptr;
+}
 #endif
 
 - (BOOL)useFSync
@@ -138,6 +193,26 @@
 	_options.use_fsync = useFSync;
 }
 
+- (BOOL)allowMmapReads
+{
+	return _options.allow_mmap_reads;
+}
+
+- (void)setAllowMmapReads:(BOOL)allowMmapReads
+{
+	_options.allow_mmap_reads = allowMmapReads;
+}
+
+- (BOOL)allowMmapWrites
+{
+	return _options.allow_mmap_writes;
+}
+
+- (void)setAllowMmapWrites:(BOOL)allowMmapWrites
+{
+	_options.allow_mmap_writes = allowMmapWrites;
+}
+
 - (size_t)maxLogFileSize
 {
 	return _options.max_log_file_size;
@@ -178,4 +253,14 @@
 	_options.bytes_per_sync = bytesPerSync;
 }
 
+- (uint32_t)maxSubcompactions
+{
+	return _options.max_subcompactions;
+}
+
+- (void)setMaxSubcompactions:(uint32_t)maxSubcompactions
+{
+	_options.max_subcompactions = maxSubcompactions;
+}
+
 @end
@@ -0,0 +1,242 @@
+//
+//  RocksDBEventListener.h
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class RocksDBFlushJobInfo;
+@class RocksDBCompactionJobInfo;
+@class RocksDBWriteStallInfo;
+@class RocksDBTableFileCreationInfo;
+@class RocksDBTableFileDeletionInfo;
+
+/** @brief The write stall condition of a column family. */
+typedef NS_ENUM(int, RocksDBWriteStallCondition)
+{
+	/** @brief Writes are not stalled. */
+	RocksDBWriteStallConditionNormal = 0,
+
+	/** @brief Writes are delayed. */
+	RocksDBWriteStallConditionDelayed,
+
+	/** @brief Writes are stopped. */
+	RocksDBWriteStallConditionStopped
+};
+
+/** @brief The reason a table file was created. */
+typedef NS_ENUM(int, RocksDBTableFileCreationReason)
+{
+	/** @brief The file was created by a flush. */
+	RocksDBTableFileCreationReasonFlush = 0,
+
+	/** @brief The file was created by a compaction. */
+	RocksDBTableFileCreationReasonCompaction,
+
+	/** @brief The file was created during recovery. */
+	RocksDBTableFileCreationReasonRecovery,
+
+	/** @brief The file was created for any other reason. */
+	RocksDBTableFileCreationReasonMisc
+};
+
+/**
+ A `RocksDBEventListener`, when set in the `RocksDBDatabaseOptions`, is notified about flushes, compactions,
+ write stall changes and the table files' lifecycle.
+
+ @discussion RocksDB notifies listeners on its background threads. The listener copies each event's data into
+ an immutable info object and delivers it asynchronously on its queue, so that the blocks never block
+ RocksDB's background work. Events for which no block is set are ignored without copying any data.
+ */
+@interface RocksDBEventListener : NSObject
+
+/**
+ Initializes a new instance of an event listener, which delivers the events on a private serial queue.
+
+ @return A newly-initialized instance of an event listener.
+ */
+- (instancetype)init;
+
+/**
+ Initializes a new instance of an event listener, which delivers the events on the given queue.
+
+ @param queue The queue on which the blocks are called.
+ @return A newly-initialized instance of an event listener.
+ */
+- (instancetype)initWithQueue:(dispatch_queue_t)queue;
+
+/** @brief The queue on which the blocks are called. */
+@property (nonatomic, strong, readonly) dispatch_queue_t queue;
+
+/** @brief Called after a flush has completed. */
+@property (atomic, copy, nullable) void (^flushCompletedBlock)(RocksDBFlushJobInfo *info);
+
+/** @brief Called after a compaction has completed, successfully or not. */
+@property (atomic, copy, nullable) void (^compactionCompletedBlock)(RocksDBCompactionJobInfo *info);
+
+/** @brief Called when the write stall condition of a column family has changed. */
+@property (atomic, copy, nullable) void (^stallConditionsChangedBlock)(RocksDBWriteStallInfo *info);
+
+/** @brief Called after a table file has been created, successfully or not. */
+@property (atomic, copy, nullable) void (^tableFileCreatedBlock)(RocksDBTableFileCreationInfo *info);
+
+/** @brief Called after a table file has been deleted. */
+@property (atomic, copy, nullable) void (^tableFileDeletedBlock)(RocksDBTableFileDeletionInfo *info);
+
+@end
+
+/**
+ Describes a completed flush.
+ */
+@interface RocksDBFlushJobInfo : NSObject
+
+/** @brief The name of the column family. */
+@property (nonatomic, copy, readonly) NSString *columnFamilyName;
+
+/** @brief The path to the newly created file. */
+@property (nonatomic, copy, readonly) NSString *filePath;
+
+/** @brief The id of the thread that completed the flush. */
+@property (nonatomic, assign, readonly) uint64_t threadId;
+
+/** @brief The job id, which is unique within the same thread. */
+@property (nonatomic, assign, readonly) int jobId;
+
+/** @brief Whether the flush was triggered because writes were slowed down by too many files in L0. */
+@property (nonatomic, assign, readonly) BOOL triggeredWritesSlowdown;
+
+/** @brief Whether the flush was triggered because writes were stopped by too many files in L0. */
+@property (nonatomic, assign, readonly) BOOL triggeredWritesStop;
+
+/** @brief The smallest sequence number in the newly created file. */
+@property (nonatomic, assign, readonly) uint64_t smallestSequenceNumber;
+
+/** @brief The largest sequence number in the newly created file. */
+@property (nonatomic, assign, readonly) uint64_t largestSequenceNumber;
+
+/** @brief The number of entries in the newly created file. */
+@property (nonatomic, assign, readonly) uint64_t numberOfEntries;
+
+/** @brief The size of the data blocks in the newly created file. */
+@property (nonatomic, assign, readonly) uint64_t dataSize;
+
+@end
+
+/**
+ Describes a completed compaction.
+ */
+@interface RocksDBCompactionJobInfo : NSObject
+
+/** @brief The name of the column family. */
+@property (nonatomic, copy, readonly) NSString *columnFamilyName;
+
+/** @brief The error that occurred during the compaction, or nil if it succeeded. */
+@property (nonatomic, strong, readonly, nullable) NSError *error;
+
+/** @brief The id of the thread that completed the compaction. */
+@property (nonatomic, assign, readonly) uint64_t threadId;
+
+/** @brief The job id, which is unique within the same thread. */
+@property (nonatomic, assign, readonly) int jobId;
+
+/** @brief The smallest input level of the compaction. */
+@property (nonatomic, assign, readonly) int baseInputLevel;
+
+/** @brief The output level of the compaction. */
+@property (nonatomic, assign, readonly) int outputLevel;
+
+/** @brief The paths of the compaction's input files. */
+@property (nonatomic, copy, readonly) NSArray<NSString *> *inputFiles;
+
+/** @brief The paths of the compaction's output files. */
+@property (nonatomic, copy, readonly) NSArray<NSString *> *outputFiles;
+
+/** @brief The time the compaction took, in microseconds. */
+@property (nonatomic, assign, readonly) uint64_t elapsedMicros;
+
+/** @brief The number of compaction input records. */
+@property (nonatomic, assign, readonly) uint64_t numberOfInputRecords;
+
+/** @brief The number of compaction output records. */
+@property (nonatomic, assign, readonly) uint64_t numberOfOutputRecords;
+
+/** @brief The size of the compaction input in bytes. */
+@property (nonatomic, assign, readonly) uint64_t totalInputBytes;
+
+/** @brief The size of the compaction output in bytes. */
+@property (nonatomic, assign, readonly) uint64_t totalOutputBytes;
+
+@end
+
+/**
+ Describes a change of the write stall condition of a column family.
+ */
+@interface RocksDBWriteStallInfo : NSObject
+
+/** @brief The name of the column family. */
+@property (nonatomic, copy, readonly) NSString *columnFamilyName;
+
+/** @brief The current write stall condition. */
+@property (nonatomic, assign, readonly) RocksDBWriteStallCondition currentCondition;
+
+/** @brief The previous write stall condition. */
+@property (nonatomic, assign, readonly) RocksDBWriteStallCondition previousCondition;
+
+@end
+
+/**
+ Describes the creation of a table file.
+ */
+@interface RocksDBTableFileCreationInfo : NSObject
+
+/** @brief The name of the database where the file was created. */
+@property (nonatomic, copy, readonly) NSString *databaseName;
+
+/** @brief The name of the column family where the file was created. */
+@property (nonatomic, copy, readonly) NSString *columnFamilyName;
+
+/** @brief The path to the created file. */
+@property (nonatomic, copy, readonly) NSString *filePath;
+
+/** @brief The id of the job which created the file. */
+@property (nonatomic, assign, readonly) int jobId;
+
+/** @brief The reason for creating the file. */
+@property (nonatomic, assign, readonly) RocksDBTableFileCreationReason reason;
+
+/** @brief The size of the file. */
+@property (nonatomic, assign, readonly) uint64_t fileSize;
+
+/** @brief The number of entries in the file. */
+@property (nonatomic, assign, readonly) uint64_t numberOfEntries;
+
+/** @brief The error that occurred during the file creation, or nil if it succeeded. */
+@property (nonatomic, strong, readonly, nullable) NSError *error;
+
+@end
+
+/**
+ Describes the deletion of a table file.
+ */
+@interface RocksDBTableFileDeletionInfo : NSObject
+
+/** @brief The name of the database where the file was deleted. */
+@property (nonatomic, copy, readonly) NSString *databaseName;
+
+/** @brief The path to the deleted file. */
+@property (nonatomic, copy, readonly) NSString *filePath;
+
+/** @brief The id of the job which deleted the file. */
+@property (nonatomic, assign, readonly) int jobId;
+
+/** @brief The error that occurred during the file deletion, or nil if it succeeded. */
+@property (nonatomic, strong, readonly, nullable) NSError *error;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,252 @@
+//
+//  RocksDBEventListener.mm
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#import "RocksDBEventListener.h"
+#import "RocksDBCallbackEventListener.h"
+#import "RocksDBError.h"
+
+#import <rocksdb/listener.h>
+
+static NSString * StringFromNative(const std::string &string)
+{
+	return [NSString stringWithCString:string.c_str() encoding:NSUTF8StringEncoding];
+}
+
+static NSArray<NSString *> * StringsFromNative(const std::vector<std::string> &strings)
+{
+	NSMutableArray *array = [NSMutableArray arrayWithCapacity:strings.size()];
+	for (const auto &string : strings) {
+		[array addObject:StringFromNative(string)];
+	}
+	return array;
+}
+
+static NSError * ErrorFromNative(const rocksdb::Status &status)
+{
+	return status.ok() ? nil : [RocksDBError errorWithRocksStatus:status];
+}
+
+#pragma mark - Info
+
+@implementation RocksDBFlushJobInfo
+
+- (instancetype)initWithNativeInfo:(const rocksdb::FlushJobInfo &)info
+{
+	self = [super init];
+	if (self) {
+		self->_columnFamilyName = StringFromNative(info.cf_name);
+		self->_filePath = StringFromNative(info.file_path);
+		self->_threadId = info.thread_id;
+		self->_jobId = info.job_id;
+		self->_triggeredWritesSlowdown = info.triggered_writes_slowdown;
+		self->_triggeredWritesStop = info.triggered_writes_stop;
+		self->_smallestSequenceNumber = info.smallest_seqno;
+		self->_largestSequenceNumber = info.largest_seqno;
+		self->_numberOfEntries = info.table_properties.num_entries;
+		self->_dataSize = info.table_properties.data_size;
+	}
+	return self;
+}
+
+@end
+
+@implementation RocksDBCompactionJobInfo
+
+- (instancetype)initWithNativeInfo:(const rocksdb::CompactionJobInfo &)info
+{
+	self = [super init];
+	if (self) {
+		self->_columnFamilyName = StringFromNative(info.cf_name);
+		self->_error = ErrorFromNative(info.status);
+		self->_threadId = info.thread_id;
+		self->_jobId = info.job_id;
+		self->_baseInputLevel = info.base_input_level;
+		self->_outputLevel = info.output_level;
+		self->_inputFiles = StringsFromNative(info.input_files);
+		self->_outputFiles = StringsFromNative(info.output_files);
+		self->_elapsedMicros = info.stats.elapsed_micros;
+		self->_numberOfInputRecords = info.stats.num_input_records;
+		self->_numberOfOutputRecords = info.stats.num_output_records;
+		self->_totalInputBytes = info.stats.total_input_bytes;
+		self->_totalOutputBytes = info.stats.total_output_bytes;
+	}
+	return self;
+}
+
+@end
+
+@implementation RocksDBWriteStallInfo
+
+- (instancetype)initWithNativeInfo:(const rocksdb::WriteStallInfo &)info
+{
+	self = [super init];
+	if (self) {
+		self->_columnFamilyName = StringFromNative(info.cf_name);
+		self->_currentCondition = (RocksDBWriteStallCondition)info.condition.cur;
+		self->_previousCondition = (RocksDBWriteStallCondition)info.condition.prev;
+	}
+	return self;
+}
+
+@end
+
+@implementation RocksDBTableFileCreationInfo
+
+- (instancetype)initWithNativeInfo:(const rocksdb::TableFileCreationInfo &)info
+{
+	self = [super init];
+	if (self) {
+		self->_databaseName = StringFromNative(info.db_name);
+		self->_columnFamilyName = StringFromNative(info.cf_name);
+		self->_filePath = StringFromNative(info.file_path);
+		self->_jobId = info.job_id;
+		self->_reason = (RocksDBTableFileCreationReason)info.reason;
+		self->_fileSize = info.file_size;
+		self->_numberOfEntries = info.table_properties.num_entries;
+		self->_error = ErrorFromNative(info.status);
+	}
+	return self;
+}
+
+@end
+
+@implementation RocksDBTableFileDeletionInfo
+
+- (instancetype)initWithNativeInfo:(const rocksdb::TableFileDeletionInfo &)info
+{
+	self = [super init];
+	if (self) {
+		self->_databaseName = StringFromNative(info.db_name);
+		self->_filePath = StringFromNative(info.file_path);
+		self->_jobId = info.job_id;
+		self->_error = ErrorFromNative(info.status);
+	}
+	return self;
+}
+
+@end
+
+#pragma mark - Listener
+
+@interface RocksDBEventListener ()
+{
+	std::shared_ptr<rocksdb::EventListener> _listener;
+}
+@property (nonatomic, assign) std::shared_ptr<rocksdb::EventListener> listener;
+@end
+
+@implementation RocksDBEventListener
+@synthesize listener = _listener;
+
+#pragma mark - Lifecycle
+
+- (instancetype)init
+{
+	return [self initWithQueue:dispatch_queue_create("org.BrainCookie.ObjectiveRocks.EventListener", DISPATCH_QUEUE_SERIAL)];
+}
+
+- (instancetype)initWithQueue:(dispatch_queue_t)queue
+{
+	self = [super init];
+	if (self) {
+		_queue = queue;
+		_listener.reset(RocksDBCallbackEventListener((__bridge void *)self,
+													 &trampolineFlushCompleted,
+													 &trampolineCompactionCompleted,
+													 &trampolineStallConditionsChanged,
+													 &trampolineTableFileCreated,
+													 &trampolineTableFileDeleted));
+	}
+	return self;
+}
+
+- (void)dealloc
+{
+	@synchronized(self) {
+		if (_listener != nullptr) {
+			_listener.reset();
+		}
+	}
+}
+
+#pragma mark - Callbacks
+
+// The info objects are created on RocksDB's background thread, since the native info is only
+// valid during the callback, while the blocks are called asynchronously on the listener's queue
+
+void trampolineFlushCompleted(void* instance, const rocksdb::FlushJobInfo& info)
+{
+	@autoreleasepool {
+		RocksDBEventListener *listener = (__bridge RocksDBEventListener *)instance;
+		void (^block)(RocksDBFlushJobInfo *) = listener.flushCompletedBlock;
+		if (block == nil) return;
+
+		RocksDBFlushJobInfo *jobInfo = [[RocksDBFlushJobInfo alloc] initWithNativeInfo:info];
+		dispatch_async(listener.queue, ^{
+			block(jobInfo);
+		});
+	}
+}
+
+void trampolineCompactionCompleted(void* instance, const rocksdb::CompactionJobInfo& info)
+{
+	@autoreleasepool {
+		RocksDBEventListener *listener = (__bridge RocksDBEventListener *)instance;
+		void (^block)(RocksDBCompactionJobInfo *) = listener.compactionCompletedBlock;
+		if (block == nil) return;
+
+		RocksDBCompactionJobInfo *jobInfo = [[RocksDBCompactionJobInfo alloc] initWithNativeInfo:info];
+		dispatch_async(listener.queue, ^{
+			block(jobInfo);
+		});
+	}
+}
+
+void trampolineStallConditionsChanged(void* instance, const rocksdb::WriteStallInfo& info)
+{
+	@autoreleasepool {
+		RocksDBEventListener *listener = (__bridge RocksDBEventListener *)instance;
+		void (^block)(RocksDBWriteStallInfo *) = listener.stallConditionsChangedBlock;
+		if (block == nil) return;
+
+		RocksDBWriteStallInfo *stallInfo = [[RocksDBWriteStallInfo alloc] initWithNativeInfo:info];
+		dispatch_async(listener.queue, ^{
+			block(stallInfo);
+		});
+	}
+}
+
+void trampolineTableFileCreated(void* instance, const rocksdb::TableFileCreationInfo& info)
+{
+	@autoreleasepool {
+		RocksDBEventListener *listener = (__bridge RocksDBEventListener *)instance;
+		void (^block)(RocksDBTableFileCreationInfo *) = listener.tableFileCreatedBlock;
+		if (block == nil) return;
+
+		RocksDBTableFileCreationInfo *fileInfo = [[RocksDBTableFileCreationInfo alloc] initWithNativeInfo:info];
+		dispatch_async(listener.queue, ^{
+			block(fileInfo);
+		});
+	}
+}
+
+void trampolineTableFileDeleted(void* instance, const rocksdb::TableFileDeletionInfo& info)
+{
+	@autoreleasepool {
+		RocksDBEventListener *listener = (__bridge RocksDBEventListener *)instance;
+		void (^block)(RocksDBTableFileDeletionInfo *) = listener.tableFileDeletedBlock;
+		if (block == nil) return;
+
+		RocksDBTableFileDeletionInfo *fileInfo = [[RocksDBTableFileDeletionInfo alloc] initWithNativeInfo:info];
+		dispatch_async(listener.queue, ^{
+			block(fileInfo);
+		});
+	}
+}
+
+@end
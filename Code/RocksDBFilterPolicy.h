@@ -16,9 +16,12 @@ NS_ASSUME_NONNULL_BEGIN
 @interface RocksDBFilterPolicy : NSObject
 
 /**
- Return a new filter policy that uses a bloom filter with approximately
+ Return a new filter policy that uses a full bloom filter with approximately
  the specified number of bits per key.
- 
+
+ @discussion A full filter covers all keys of a table file, and is checked once
+ per file instead of once per data block. It is required for partitioned filters.
+
  @param bitsPerKey The number of bits per key.
  */
 + (instancetype)bloomFilterPolicyWithBitsPerKey:(int)bitsPerKey;
@@ -28,7 +31,8 @@ NS_ASSUME_NONNULL_BEGIN
  the specified number of bits per key.
  
  @param bitsPerKey The number of bits per key.
- @param useBlockBasedBuilder Use block-based builder.
+ @param useBlockBasedBuilder Use the deprecated block-based builder, which creates
+ one filter per data block, instead of a full filter per table file.
  */
 + (instancetype)bloomFilterPolicyWithBitsPerKey:(int)bitsPerKey useBlockBasedBuilder:(BOOL)useBlockBasedBuilder;
 
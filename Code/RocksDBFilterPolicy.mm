@@ -12,9 +12,9 @@
 
 @interface RocksDBFilterPolicy ()
 {
-	const rocksdb::FilterPolicy *_filterPolicy;
+	std::shared_ptr<const rocksdb::FilterPolicy> _filterPolicy;
 }
-@property (nonatomic, assign) const rocksdb::FilterPolicy *filterPolicy;
+@property (nonatomic, assign) std::shared_ptr<const rocksdb::FilterPolicy> filterPolicy;
 @end
 
 @implementation RocksDBFilterPolicy
@@ -22,7 +22,7 @@
 
 + (instancetype)bloomFilterPolicyWithBitsPerKey:(int)bitsPerKey
 {
-	return [[RocksDBFilterPolicy alloc] initWithNativeFilterPolicy:rocksdb::NewBloomFilterPolicy(bitsPerKey)];
+	return [[RocksDBFilterPolicy alloc] initWithNativeFilterPolicy:rocksdb::NewBloomFilterPolicy(bitsPerKey, false)];
 }
 
 + (instancetype)bloomFilterPolicyWithBitsPerKey:(int)bitsPerKey useBlockBasedBuilder:(BOOL)useBlockBasedBuilder
@@ -34,7 +34,7 @@
 {
 	self = [super init];
 	if (self) {
-		_filterPolicy = filterPolicy;
+		_filterPolicy.reset(filterPolicy);
 	}
 	return self;
 }
@@ -43,8 +43,7 @@
 {
 	@synchronized(self) {
 		if (_filterPolicy != nullptr) {
-			delete _filterPolicy;
-			_filterPolicy = nullptr;
+			_filterPolicy.reset();
 		}
 	}
 }
@@ -0,0 +1,44 @@
+//
+//  RocksDBMemoryUsage.h
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class RocksDBCache;
+
+/**
+ The approximate memory usage of a set of databases and caches, broken down by type.
+
+ @see +[RocksDB approximateMemoryUsageForDatabases:caches:]
+ */
+@interface RocksDBMemoryUsage : NSObject
+
+/** @brief The memory used by all memtables, including the flushed ones that are still pinned, in bytes. */
+@property (nonatomic, assign, readonly) uint64_t memTableTotal;
+
+/** @brief The memory used by the memtables which haven't been flushed yet, in bytes. */
+@property (nonatomic, assign, readonly) uint64_t memTableUnflushed;
+
+/** @brief The memory used by the table readers, i.e. indexes and filters not stored in the block cache, in bytes. */
+@property (nonatomic, assign, readonly) uint64_t tableReadersTotal;
+
+/** @brief The memory used by all given caches, in bytes. Caches shared by multiple databases are counted once. */
+@property (nonatomic, assign, readonly) uint64_t cacheTotal;
+
+/**
+ Returns the memory used by the given cache.
+
+ @param cache One of the caches for which the memory usage was computed.
+ @return The memory used by the given cache in bytes, or 0 if the cache wasn't part of the computation.
+ */
+- (uint64_t)usageForCache:(RocksDBCache *)cache;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,79 @@
+//
+//  RocksDBMemoryUsage.mm
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#import "RocksDBMemoryUsage.h"
+#import "RocksDBCache.h"
+
+#import <rocksdb/cache.h>
+#import <rocksdb/utilities/memory_util.h>
+
+#include <map>
+
+#pragma mark - Informal Protocols
+
+@interface RocksDBCache ()
+@property (nonatomic, assign) std::shared_ptr<rocksdb::Cache> cache;
+@end
+
+#pragma mark - Impl
+
+@interface RocksDBMemoryUsage ()
+{
+	NSMapTable<RocksDBCache *, NSNumber *> *_cacheUsage;
+}
+@property (nonatomic, assign) uint64_t memTableTotal;
+@property (nonatomic, assign) uint64_t memTableUnflushed;
+@property (nonatomic, assign) uint64_t tableReadersTotal;
+@property (nonatomic, assign) uint64_t cacheTotal;
+@end
+
+@implementation RocksDBMemoryUsage
+@synthesize memTableTotal = _memTableTotal;
+@synthesize memTableUnflushed = _memTableUnflushed;
+@synthesize tableReadersTotal = _tableReadersTotal;
+@synthesize cacheTotal = _cacheTotal;
+
+- (instancetype)initWithNativeUsage:(const std::map<rocksdb::MemoryUtil::UsageType, uint64_t> &)usage
+							 caches:(NSArray<RocksDBCache *> *)caches
+{
+	self = [super init];
+	if (self) {
+		auto valueForType = [&usage](rocksdb::MemoryUtil::UsageType type) -> uint64_t {
+			auto it = usage.find(type);
+			return it != usage.end() ? it->second : 0;
+		};
+
+		_memTableTotal = valueForType(rocksdb::MemoryUtil::kMemTableTotal);
+		_memTableUnflushed = valueForType(rocksdb::MemoryUtil::kMemTableUnFlushed);
+		_tableReadersTotal = valueForType(rocksdb::MemoryUtil::kTableReadersTotal);
+		_cacheTotal = valueForType(rocksdb::MemoryUtil::kCacheTotal);
+
+		_cacheUsage = [NSMapTable mapTableWithKeyOptions:NSPointerFunctionsObjectPointerPersonality
+											valueOptions:NSPointerFunctionsStrongMemory];
+		for (RocksDBCache *cache in caches) {
+			[_cacheUsage setObject:@(cache.cache->GetUsage()) forKey:cache];
+		}
+	}
+	return self;
+}
+
+- (uint64_t)usageForCache:(RocksDBCache *)cache
+{
+	return [[_cacheUsage objectForKey:cache] unsignedLongLongValue];
+}
+
+#pragma mark - Description
+
+- (NSString *)description
+{
+	return [NSString stringWithFormat:@"<%@: %p, memTableTotal: %llu, memTableUnflushed: %llu, tableReadersTotal: %llu, cacheTotal: %llu>",
+			NSStringFromClass(self.class), self,
+			_memTableTotal, _memTableUnflushed, _tableReadersTotal, _cacheTotal];
+}
+
+@end
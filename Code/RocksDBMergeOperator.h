@@ -10,11 +10,94 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
+/**
+ An enum defining the built-in Merge Operators.
+ */
+typedef NS_ENUM(NSUInteger, RocksDBMergeOperatorType)
+{
+	/** @brief Adds values and operands interpreted as 64-bit unsigned integers in native byte order. */
+	RocksDBMergeOperatorUInt64Add,
+
+	/** @brief Keeps the bytewise largest of the existing value and the operands. */
+	RocksDBMergeOperatorMax,
+
+	/** @brief Keeps the most recent operand, i.e. a merge behaves like a put. Reads stop at the
+	 newest operand without looking up older operands or the existing value. */
+	RocksDBMergeOperatorPut
+};
+
+/** An opaque list of merge operands passed to a `RocksDBFullMergeFunction`. */
+typedef struct RocksDBMergeOperands RocksDBMergeOperands;
+
+/** An opaque buffer receiving the result of a merge function. */
+typedef struct RocksDBMergeValue RocksDBMergeValue;
+
+/**
+ Returns the number of operands in the given list.
+
+ @param operands The operand list passed to a `RocksDBFullMergeFunction`.
+ @return The number of operands.
+ */
+FOUNDATION_EXPORT size_t RocksDBMergeOperandsCount(const RocksDBMergeOperands *operands);
+
+/**
+ Returns the bytes of the operand at the given index, oldest operand first.
+
+ @param operands The operand list passed to a `RocksDBFullMergeFunction`.
+ @param index The index of the operand.
+ @param length Upon return contains the length of the operand, or 0 if the index is out of bounds.
+ @return The bytes of the operand, valid for the duration of the merge function, or `NULL` if the index
+ is out of bounds.
+ */
+FOUNDATION_EXPORT const char * _Nullable RocksDBMergeOperandsGet(const RocksDBMergeOperands *operands, size_t index, size_t *length);
+
+/**
+ Appends the given bytes to the merge result.
+
+ @param value The merge result passed to a merge function, which is initially empty.
+ @param data The bytes to append.
+ @param length The number of bytes to append.
+ */
+FOUNDATION_EXPORT void RocksDBMergeValueAppend(RocksDBMergeValue *value, const char *data, size_t length);
+
+/**
+ A plain C partial merge function, which combines two operands into one.
+
+ @return `true` if the operands were combined into `newValue`, `false` otherwise.
+ */
+typedef bool (* RocksDBPartialMergeFunction)(void * _Nullable context,
+											 const char *key, size_t keyLength,
+											 const char *leftOperand, size_t leftLength,
+											 const char *rightOperand, size_t rightLength,
+											 RocksDBMergeValue *newValue);
+
+/**
+ A plain C full merge function, which applies the operands on the existing value.
+
+ @return `true` if the result was written into `newValue`, `false` on failure, i.e. corrupted data.
+ */
+typedef bool (* RocksDBFullMergeFunction)(void * _Nullable context,
+										  const char *key, size_t keyLength,
+										  const char * _Nullable existingValue, size_t existingLength,
+										  const RocksDBMergeOperands *operands,
+										  RocksDBMergeValue *newValue);
+
 /** 
  A Merge operator is an atomic Read-Modify-Write operation in RocksDB.
  */
 @interface RocksDBMergeOperator : NSObject
 
+/**
+ Initializes a new instance of a built-in merge operator.
+
+ @discussion The built-in merge operators are implemented natively and do not call back into
+ Objective-C, neither for merging nor for the `AllowSingleOperand` and `ShouldMerge` hooks.
+
+ @param type The merge operator type.
+ @return A newly-initialized instance of the Merge Operator.
+ */
++ (instancetype)operatorWithType:(RocksDBMergeOperatorType)type;
+
 /**
  Initializes a new instance of an associative merge operator.
 
@@ -47,6 +130,13 @@ NS_ASSUME_NONNULL_BEGIN
  client-specified MergeOperator should then apply the operands one-by-one and return the resulting object. 
  If `nil` is returned, then this indicates a failure, i.e. corrupted data, errors ... etc.
 
+ @remark The `operandList` passed to the full merge block is a view over RocksDB's own operand
+ buffers, so no operand is copied when the block is called, and its elements are views reused across
+ calls on the same thread. The list and its elements are only valid for the duration of the block:
+ afterwards the list is empty, and a retained element is emptied or points at the operand of a later
+ merge. `copy` the list or an element, or use `+[NSData dataWithData:]`, to keep them around. Returning
+ an element as the merge result is safe.
+
  @param name The name of the merge operator.
  @param partialMergeBlock The block to perform a partial merge.
  @param fullMergeBlock The block to perform the full merge.
@@ -56,6 +146,62 @@ NS_ASSUME_NONNULL_BEGIN
 			   partialMergeBlock:(NSData * _Nullable (^)(NSData * key, NSData *leftOperand, NSData *rightOperand))partialMergeBlock
 				  fullMergeBlock:(NSData * _Nullable (^)(NSData * key, NSData * _Nullable existingValue, NSArray<NSData *> *operandList))fullMergeBlock;
 
+/**
+ Initializes a new instance of a generic merge operator, which can bound the operand chains
+ read by point lookups.
+
+ @discussion In addition to the partial and full merge blocks:
+
+ * ShouldMerge: called on point lookups with the operands collected so far, in reverse order, i.e. the
+ most recent operand first. If `YES` is returned, the lookup stops and the full merge block is called
+ with these operands and a `nil` existing value. This allows for early termination, when the newest
+ operands alone determine the result, e.g. an operand that overwrites the value. Like the full merge
+ block's `operandList`, the list and its elements are only valid for the duration of the block.
+
+ * AllowSingleOperand: if `YES` the partial merge block is also called for a single operand, e.g. when
+ a compaction finds only one operand of a key and no base value, which gives the operator a chance to
+ rewrite or normalize the operand. In this case the operand is passed as `rightOperand` and the
+ `leftOperand` is empty. Returning `nil` keeps the operand unchanged.
+
+ Together with `maxSuccessiveMerges` in `RocksDBColumnFamilyOptions` this bounds the read latency
+ for keys with long operand chains. The number of operands seen per point lookup is reported by the
+ `RocksDBHistogramReadNumMergeOperands` histogram in `RocksDBStatistics`.
+
+ @param name The name of the merge operator.
+ @param partialMergeBlock The block to perform a partial merge.
+ @param fullMergeBlock The block to perform the full merge.
+ @param shouldMergeBlock The block to decide whether the collected operands suffice for a full merge.
+ @param allowSingleOperand Whether a partial merge may be performed for a single operand.
+ @return A newly-initialized instance of the Merge Operator.
+
+ @see RocksDBColumnFamilyOptions
+ @see RocksDBStatistics
+ */
++ (instancetype)operatorWithName:(NSString *)name
+			   partialMergeBlock:(NSData * _Nullable (^)(NSData * key, NSData *leftOperand, NSData *rightOperand))partialMergeBlock
+				  fullMergeBlock:(NSData * _Nullable (^)(NSData * key, NSData * _Nullable existingValue, NSArray<NSData *> *operandList))fullMergeBlock
+				shouldMergeBlock:(nullable BOOL (^)(NSArray<NSData *> *operandList))shouldMergeBlock
+			  allowSingleOperand:(BOOL)allowSingleOperand;
+
+/**
+ Initializes a new instance of a generic merge operator with plain C merge functions.
+
+ @discussion The functions are called directly from RocksDB, without any Objective-C message send,
+ `NSData` boxing or autorelease traffic, and work on RocksDB's own buffers. The result is appended
+ into RocksDB's output buffer via `RocksDBMergeValueAppend`. The functions may be called concurrently
+ from multiple threads. The context is neither retained nor freed and must outlive the database.
+
+ @param name The name of the merge operator.
+ @param context An arbitrary pointer passed to the functions.
+ @param partialMergeFunction The function to perform a partial merge, `NULL` if operands can't be combined.
+ @param fullMergeFunction The function to perform the full merge.
+ @return A newly-initialized instance of the Merge Operator.
+ */
++ (instancetype)operatorWithName:(NSString *)name
+						 context:(nullable void *)context
+			partialMergeFunction:(nullable RocksDBPartialMergeFunction)partialMergeFunction
+			   fullMergeFunction:(RocksDBFullMergeFunction)fullMergeFunction;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -10,6 +10,7 @@
 #import "RocksDBSlice.h"
 #import "RocksDBCallbackAssociativeMergeOperator.h"
 #import "RocksDBCallbackMergeOperator.h"
+#import "RocksDBNativeMergeOperator.h"
 
 #import <rocksdb/slice.h>
 #import <rocksdb/env.h>
@@ -25,6 +26,163 @@
 @property (nonatomic, assign) rocksdb::MergeOperator *mergeOperator;
 @end
 
+#pragma mark - Operand Data
+
+/**
+ A reusable `NSData` view over a single merge operand, which is re-pointed at another operand
+ instead of being reallocated. Copies are regular `NSData` objects owning their bytes.
+ */
+@interface RocksDBMergeOperandData : NSData
+{
+	const char *_bytes;
+	NSUInteger _length;
+}
+- (void)setSlice:(const rocksdb::Slice &)slice;
+@end
+
+@implementation RocksDBMergeOperandData
+
+- (void)setSlice:(const rocksdb::Slice &)slice
+{
+	_bytes = slice.data();
+	_length = slice.size();
+}
+
+- (const void *)bytes
+{
+	return _bytes;
+}
+
+- (NSUInteger)length
+{
+	return _length;
+}
+
+- (id)copyWithZone:(NSZone *)zone
+{
+	return [[NSData allocWithZone:zone] initWithBytes:_bytes length:_length];
+}
+
+@end
+
+#pragma mark - Operand List
+
+static const std::vector<rocksdb::Slice> kNoOperands;
+
+/**
+ An immutable array view over the merge operands handed to `FullMergeV2` and `ShouldMerge`.
+ The operand bytes are not copied and the element views are reused, thus accessing an operand
+ doesn't allocate once the list has grown to the longest operand chain. After the full merge or
+ should merge block returns, the list is empty and its elements are emptied.
+ */
+@interface RocksDBMergeOperandList : NSArray
+{
+	const std::vector<rocksdb::Slice> *_operands;
+	NSMutableArray<RocksDBMergeOperandData *> *_views;
+}
+- (void)setOperands:(const std::vector<rocksdb::Slice> *)operands;
+- (void)invalidate;
+@end
+
+@implementation RocksDBMergeOperandList
+
+- (instancetype)init
+{
+	self = [super init];
+	if (self) {
+		_operands = &kNoOperands;
+		_views = [NSMutableArray array];
+	}
+	return self;
+}
+
+- (void)setOperands:(const std::vector<rocksdb::Slice> *)operands
+{
+	_operands = operands;
+}
+
+- (void)invalidate
+{
+	_operands = &kNoOperands;
+	for (RocksDBMergeOperandData *view in _views) {
+		[view setSlice:rocksdb::Slice()];
+	}
+}
+
+- (NSUInteger)count
+{
+	return _operands->size();
+}
+
+- (id)objectAtIndex:(NSUInteger)index
+{
+	if (index >= _operands->size()) {
+		[NSException raise:NSRangeException
+					format:@"Index %lu beyond bounds [0 .. %lu]", (unsigned long)index, (unsigned long)_operands->size()];
+	}
+
+	while (_views.count <= index) {
+		[_views addObject:[RocksDBMergeOperandData new]];
+	}
+	RocksDBMergeOperandData *view = _views[index];
+	[view setSlice:(*_operands)[index]];
+	return view;
+}
+
+- (id)copyWithZone:(NSZone *)zone
+{
+	NSMutableArray *operands = [NSMutableArray arrayWithCapacity:_operands->size()];
+	for (const auto &slice : *_operands) {
+		[operands addObject:DataFromSlice(slice)];
+	}
+	return [operands copy];
+}
+
+@end
+
+/**
+ Each thread reuses a single operand list. A merge nested in a merge block on the same thread,
+ e.g. a lookup of another key, gets a list of its own.
+ */
+struct RocksDBReusableOperandList
+{
+	CFTypeRef list = nullptr;
+	bool inUse = false;
+
+	~RocksDBReusableOperandList()
+	{
+		if (list != nullptr) {
+			CFRelease(list);
+		}
+	}
+};
+
+static thread_local RocksDBReusableOperandList reusableOperandList;
+
+static RocksDBMergeOperandList * AcquireOperandList(const std::vector<rocksdb::Slice> &operand_list)
+{
+	RocksDBMergeOperandList *operands = nil;
+	if (reusableOperandList.inUse) {
+		operands = [RocksDBMergeOperandList new];
+	} else {
+		if (reusableOperandList.list == nullptr) {
+			reusableOperandList.list = CFBridgingRetain([RocksDBMergeOperandList new]);
+		}
+		reusableOperandList.inUse = true;
+		operands = (__bridge RocksDBMergeOperandList *)reusableOperandList.list;
+	}
+	[operands setOperands:&operand_list];
+	return operands;
+}
+
+static void RelinquishOperandList(RocksDBMergeOperandList *operands)
+{
+	[operands invalidate];
+	if ((__bridge CFTypeRef)operands == reusableOperandList.list) {
+		reusableOperandList.inUse = false;
+	}
+}
+
 #pragma mark - Associative Merge Operator
 
 @interface RocksDBAssociativeMergeOperator : RocksDBMergeOperator
@@ -81,6 +239,7 @@ bool trampoline(void* instance,
 {
 	NSData * (^ _partialMergeBlock)(NSData * key, NSData *leftOperand, NSData *rightOperand);
 	NSData * (^ _fullMergeBlock)(NSData * key, NSData * existingValue, NSArray<NSData *> *operandList);
+	BOOL (^ _shouldMergeBlock)(NSArray<NSData *> *operandList);
 }
 @end
 
@@ -89,13 +248,19 @@ bool trampoline(void* instance,
 - (instancetype)initWithName:(NSString *)name
 		   partialMergeBlock:(NSData * (^)(NSData *key, NSData *leftOperand, NSData *rightOperand))partialMergeBlock
 			  fullMergeBlock:(NSData * (^)(NSData *key, NSData *existingValue, NSArray<NSData *> *operandList))fullMergeBlock
+			shouldMergeBlock:(BOOL (^)(NSArray<NSData *> *operandList))shouldMergeBlock
+		  allowSingleOperand:(BOOL)allowSingleOperand
 {
 	self = [super init];
 	if (self) {
 		self.name = name;
-		self.mergeOperator = RocksDBCallbackMergeOperator((__bridge void *)self, name.UTF8String, &trampolinePartialMerge, &trampolineFullMerge);
+		self.mergeOperator = RocksDBCallbackMergeOperator((__bridge void *)self, name.UTF8String,
+														  &trampolinePartialMerge, &trampolineFullMerge,
+														  shouldMergeBlock ? &trampolineShouldMerge : nullptr,
+														  allowSingleOperand);
 		_partialMergeBlock = [partialMergeBlock copy];
 		_fullMergeBlock = [fullMergeBlock copy];
+		_shouldMergeBlock = [shouldMergeBlock copy];
 	}
 	return self;
 }
@@ -133,40 +298,153 @@ bool trampolinePartialMerge(void* instance,
 bool trampolineFullMerge(void* instance,
 						 const rocksdb::Slice& key,
 						 const rocksdb::Slice* existing_value,
-						 const std::deque<std::string>& operand_list,
+						 const std::vector<rocksdb::Slice>& operand_list,
 						 std::string* new_value,
 						 rocksdb::Logger* logger)
 {
-	NSData *data = [(__bridge id)instance fullMergeForKey:key
-										withExistingValue:existing_value
-										   andOperandList:operand_list];
+	@autoreleasepool {
+		NSData *data = [(__bridge id)instance fullMergeForKey:key
+											withExistingValue:existing_value
+											   andOperandList:operand_list];
 
-	if (data != nil) {
-		new_value->clear();
-		new_value->assign((char *)data.bytes, data.length);
-		return true;
+		if (data != nil) {
+			new_value->clear();
+			new_value->assign((char *)data.bytes, data.length);
+			return true;
+		}
+		return false;
 	}
-	return false;
 }
 
 - (NSData *)fullMergeForKey:(const rocksdb::Slice &)keySlice
 		  withExistingValue:(const rocksdb::Slice *)existingSlice
-			 andOperandList:(const std::deque<std::string> &)operand_list
+			 andOperandList:(const std::vector<rocksdb::Slice> &)operand_list
 {
 	NSData *key = DataFromSlice(keySlice);
 	NSData *previous = (existingSlice == nullptr) ? nil : DataFromSlice(*existingSlice);
 
-	NSMutableArray *operands = [NSMutableArray arrayWithCapacity:operand_list.size()];
+	RocksDBMergeOperandList *operands = AcquireOperandList(operand_list);
+	NSData *mergeResult = _fullMergeBlock ? _fullMergeBlock(key, previous, operands) : nil;
+	if ([mergeResult isKindOfClass:[RocksDBMergeOperandData class]]) {
+		// The block returned one of the operands, whose view is emptied below
+		mergeResult = [mergeResult copy];
+	}
+	RelinquishOperandList(operands);
+	return mergeResult;
+}
 
-	for (const auto &value : operand_list) {
-		NSData *data = DataFromSlice(rocksdb::Slice(value));
-		if (data != nil) {
-			[operands addObject:data];
-		}
+bool trampolineShouldMerge(void* instance, const std::vector<rocksdb::Slice>& operands)
+{
+	@autoreleasepool {
+		return [(__bridge id)instance shouldMergeOperandList:operands];
 	}
+}
 
-	NSData *mergeResult = _fullMergeBlock ? _fullMergeBlock(key, previous, operands) : nil;
-	return mergeResult;
+- (BOOL)shouldMergeOperandList:(const std::vector<rocksdb::Slice> &)operand_list
+{
+	RocksDBMergeOperandList *operands = AcquireOperandList(operand_list);
+	BOOL shouldMerge = _shouldMergeBlock ? _shouldMergeBlock(operands) : NO;
+	RelinquishOperandList(operands);
+	return shouldMerge;
+}
+
+@end
+
+#pragma mark - Function Merge Operator
+
+size_t RocksDBMergeOperandsCount(const RocksDBMergeOperands *operands)
+{
+	return reinterpret_cast<const std::vector<rocksdb::Slice> *>(operands)->size();
+}
+
+const char * RocksDBMergeOperandsGet(const RocksDBMergeOperands *operands, size_t index, size_t *length)
+{
+	// Exceptions must not propagate into the C callers
+	const std::vector<rocksdb::Slice> *operandList = reinterpret_cast<const std::vector<rocksdb::Slice> *>(operands);
+	if (index >= operandList->size()) {
+		*length = 0;
+		return NULL;
+	}
+
+	const rocksdb::Slice &operand = (*operandList)[index];
+	*length = operand.size();
+	return operand.data();
+}
+
+void RocksDBMergeValueAppend(RocksDBMergeValue *value, const char *data, size_t length)
+{
+	reinterpret_cast<std::string *>(value)->append(data, length);
+}
+
+struct RocksDBMergeOperatorFunctions
+{
+	void *context;
+	RocksDBPartialMergeFunction partialMerge;
+	RocksDBFullMergeFunction fullMerge;
+};
+
+@interface RocksDBFunctionMergeOperator : RocksDBMergeOperator
+{
+	RocksDBMergeOperatorFunctions _functions;
+}
+@end
+
+@implementation RocksDBFunctionMergeOperator
+
+- (instancetype)initWithName:(NSString *)name
+					 context:(void *)context
+		partialMergeFunction:(RocksDBPartialMergeFunction)partialMergeFunction
+		   fullMergeFunction:(RocksDBFullMergeFunction)fullMergeFunction
+{
+	self = [super init];
+	if (self) {
+		self.name = name;
+		_functions.context = context;
+		_functions.partialMerge = partialMergeFunction;
+		_functions.fullMerge = fullMergeFunction;
+		self.mergeOperator = RocksDBCallbackMergeOperator(&_functions, self.name.UTF8String,
+														  &trampolinePartialMergeFunction, &trampolineFullMergeFunction,
+														  nullptr, false);
+	}
+	return self;
+}
+
+bool trampolinePartialMergeFunction(void* functions,
+									const rocksdb::Slice& key,
+									const rocksdb::Slice& left_operand,
+									const rocksdb::Slice& right_operand,
+									std::string* new_value,
+									rocksdb::Logger* logger)
+{
+	RocksDBMergeOperatorFunctions *mergeOperator = static_cast<RocksDBMergeOperatorFunctions *>(functions);
+	if (mergeOperator->partialMerge == nullptr) {
+		return false;
+	}
+
+	new_value->clear();
+	return mergeOperator->partialMerge(mergeOperator->context,
+									   key.data(), key.size(),
+									   left_operand.data(), left_operand.size(),
+									   right_operand.data(), right_operand.size(),
+									   reinterpret_cast<RocksDBMergeValue *>(new_value));
+}
+
+bool trampolineFullMergeFunction(void* functions,
+								 const rocksdb::Slice& key,
+								 const rocksdb::Slice* existing_value,
+								 const std::vector<rocksdb::Slice>& operand_list,
+								 std::string* new_value,
+								 rocksdb::Logger* logger)
+{
+	RocksDBMergeOperatorFunctions *mergeOperator = static_cast<RocksDBMergeOperatorFunctions *>(functions);
+
+	new_value->clear();
+	return mergeOperator->fullMerge(mergeOperator->context,
+									key.data(), key.size(),
+									existing_value ? existing_value->data() : nullptr,
+									existing_value ? existing_value->size() : 0,
+									reinterpret_cast<const RocksDBMergeOperands *>(&operand_list),
+									reinterpret_cast<RocksDBMergeValue *>(new_value));
 }
 
 @end
@@ -177,6 +455,41 @@ bool trampolineFullMerge(void* instance,
 @synthesize name = _name;
 @synthesize mergeOperator = _mergeOperator;
 
++ (instancetype)operatorWithType:(RocksDBMergeOperatorType)type
+{
+	switch (type) {
+		case RocksDBMergeOperatorUInt64Add:
+			return [[self alloc] initWithNativeMergeOperator:RocksDBUInt64AddMergeOperator()];
+
+		case RocksDBMergeOperatorMax:
+			return [[self alloc] initWithNativeMergeOperator:RocksDBMaxMergeOperator()];
+
+		case RocksDBMergeOperatorPut:
+			return [[self alloc] initWithNativeMergeOperator:RocksDBPutMergeOperator()];
+	}
+}
+
+- (instancetype)initWithNativeMergeOperator:(rocksdb::MergeOperator *)mergeOperator
+{
+	self = [super init];
+	if (self) {
+		_name = [NSString stringWithCString:mergeOperator->Name() encoding:NSUTF8StringEncoding];
+		_mergeOperator = mergeOperator;
+	}
+	return self;
+}
+
++ (instancetype)operatorWithName:(NSString *)name
+						 context:(void *)context
+			partialMergeFunction:(RocksDBPartialMergeFunction)partialMergeFunction
+			   fullMergeFunction:(RocksDBFullMergeFunction)fullMergeFunction
+{
+	return [[RocksDBFunctionMergeOperator alloc] initWithName:name
+													  context:context
+										 partialMergeFunction:partialMergeFunction
+											fullMergeFunction:fullMergeFunction];
+}
+
 + (instancetype)operatorWithName:(NSString *)name andBlock:(NSData * (^)(NSData *, NSData *, NSData *))block
 {
 	return [[RocksDBAssociativeMergeOperator alloc] initWithName:name andBlock:block];
@@ -186,7 +499,24 @@ bool trampolineFullMerge(void* instance,
 			   partialMergeBlock:(NSData * (^)(NSData * key, NSData *leftOperand, NSData *rightOperand))partialMergeBlock
 				  fullMergeBlock:(NSData * (^)(NSData *key, NSData *existingValue, NSArray<NSData *> *operandList))fullMergeBlock
 {
-	return [[RocksDBGenericMergeOperator alloc] initWithName:name partialMergeBlock:partialMergeBlock fullMergeBlock:fullMergeBlock];
+	return [self operatorWithName:name
+				partialMergeBlock:partialMergeBlock
+				   fullMergeBlock:fullMergeBlock
+				 shouldMergeBlock:nil
+			   allowSingleOperand:NO];
+}
+
++ (instancetype)operatorWithName:(NSString *)name
+			   partialMergeBlock:(NSData * (^)(NSData * key, NSData *leftOperand, NSData *rightOperand))partialMergeBlock
+				  fullMergeBlock:(NSData * (^)(NSData *key, NSData *existingValue, NSArray<NSData *> *operandList))fullMergeBlock
+				shouldMergeBlock:(BOOL (^)(NSArray<NSData *> *operandList))shouldMergeBlock
+			  allowSingleOperand:(BOOL)allowSingleOperand
+{
+	return [[RocksDBGenericMergeOperator alloc] initWithName:name
+										   partialMergeBlock:partialMergeBlock
+											  fullMergeBlock:fullMergeBlock
+											shouldMergeBlock:shouldMergeBlock
+										  allowSingleOperand:allowSingleOperand];
 }
 
 @end
@@ -0,0 +1,94 @@
+//
+//  RocksDBMetricsExporter.h
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class RocksDB;
+@class RocksDBStatistics;
+
+/**
+ A `RocksDBMetricsExporter` periodically collects the metrics of a database and renders them in the
+ Prometheus text exposition format.
+
+ @discussion On each interval the exporter collects:
+
+ - All tickers of the `RocksDBStatistics` as counters, e.g. `rocksdb_block_cache_miss_total`.
+ - All histograms of the `RocksDBStatistics` as summaries with the 0.5, 0.95, 0.99 and 0.999
+   quantiles, which are computed from the histogram buckets, and their maximum as a `_max` gauge.
+ - All int properties in `RocksDBProperties.h` as gauges, labelled with the `column_family`.
+ - The size and the number of files of each level, and the compression ratio of each level holding
+   files as gauges, labelled with the `column_family` and the `level`.
+
+ While exporting, the metrics are collected on a private serial queue, thus no property or statistics
+ calls are made on the application's threads. The rendered text is either written atomically to a file,
+ e.g. for the node exporter's textfile collector, or served to each client connecting to a Unix domain socket.
+
+ Closing the database while exporting is safe; once it is closed only the statistics are exported.
+ */
+@interface RocksDBMetricsExporter : NSObject
+
+/**
+ Initializes a new instance of a metrics exporter for the given database.
+
+ @discussion The int properties and the level metadata are collected for the database's Column Family
+ and all Column Families returned by `-[RocksDB columnFamilies]`.
+
+ @param database The database whose metrics are exported.
+ @param statistics The statistics object set in the database's options, or nil to export only the
+ properties and the level metadata.
+ @return A newly-initialized instance of a metrics exporter.
+ */
+- (instancetype)initWithDatabase:(RocksDB *)database statistics:(nullable RocksDBStatistics *)statistics;
+
+/** @brief Whether the exporter is currently exporting. */
+@property (nonatomic, assign, readonly, getter=isRunning) BOOL running;
+
+/**
+ Starts writing the metrics to the file at the given path on each interval.
+
+ @discussion The file is replaced atomically, so that readers never see a partially written file.
+ Any running export is stopped first.
+
+ @param path The path of the file.
+ @param interval The interval between two exports, in seconds.
+ @param error If an error occurs, upon return contains an `NSError` object that describes the problem.
+ @return `YES` if the export was started, `NO` otherwise.
+ */
+- (BOOL)startExportingToFileAtPath:(NSString *)path interval:(NSTimeInterval)interval error:(NSError * __autoreleasing *)error;
+
+/**
+ Starts serving the metrics on a Unix domain socket at the given path.
+
+ @discussion The metrics are collected on each interval and the most recent ones are written to each
+ client connecting to the socket, after which the connection is closed. A stale socket file at the given
+ path is removed. Any running export is stopped first.
+
+ @param path The path of the socket.
+ @param interval The interval between two collections, in seconds.
+ @param error If an error occurs, upon return contains an `NSError` object that describes the problem.
+ @return `YES` if the socket was bound and the export was started, `NO` otherwise.
+ */
+- (BOOL)startExportingToSocketAtPath:(NSString *)path interval:(NSTimeInterval)interval error:(NSError * __autoreleasing *)error;
+
+/**
+ Stops the running export, if any, and closes the socket.
+ */
+- (void)stop;
+
+/**
+ Collects the metrics on the calling thread and renders them in the Prometheus text exposition format.
+
+ @return The rendered metrics.
+ */
+- (NSString *)prometheusText;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,349 @@
+//
+//  RocksDBMetricsExporter.mm
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#import "RocksDBMetricsExporter.h"
+#import "RocksDB.h"
+#import "RocksDBColumnFamily.h"
+#import "RocksDBColumnFamilyMetadata.h"
+#import "RocksDBProperties.h"
+#import "RocksDBStatistics.h"
+#import "RocksDBStatisticsHistogram.h"
+#import "RocksDBStatisticsSnapshot.h"
+
+#import <rocksdb/statistics.h>
+
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+static NSString * MetricName(const std::string &name)
+{
+	std::string metric(name);
+	for (auto &c : metric) {
+		if (!isalnum(static_cast<unsigned char>(c)) && c != '_') {
+			c = '_';
+		}
+	}
+	return @(metric.c_str());
+}
+
+static NSString * LabelValue(NSString *value)
+{
+	NSString *escaped = [value stringByReplacingOccurrencesOfString:@"\\" withString:@"\\\\"];
+	escaped = [escaped stringByReplacingOccurrencesOfString:@"\"" withString:@"\\\""];
+	return [escaped stringByReplacingOccurrencesOfString:@"\n" withString:@"\\n"];
+}
+
+static NSError * ErrorFromErrno(int code)
+{
+	return [NSError errorWithDomain:NSPOSIXErrorDomain code:code userInfo:nil];
+}
+
+#pragma mark - Impl
+
+@interface RocksDBMetricsExporter ()
+{
+	RocksDB *_database;
+	RocksDBStatistics *_statistics;
+	dispatch_queue_t _queue;
+	dispatch_source_t _timer;
+	dispatch_source_t _socketSource;
+	NSData *_latestMetrics;
+}
+@end
+
+@implementation RocksDBMetricsExporter
+
+#pragma mark - Lifecycle
+
+- (instancetype)initWithDatabase:(RocksDB *)database statistics:(RocksDBStatistics *)statistics
+{
+	self = [super init];
+	if (self) {
+		_database = database;
+		_statistics = statistics;
+		_queue = dispatch_queue_create("org.BrainCookie.ObjectiveRocks.MetricsExporter", DISPATCH_QUEUE_SERIAL);
+	}
+	return self;
+}
+
+- (void)dealloc
+{
+	@synchronized(self) {
+		[self stopLocked];
+	}
+}
+
+#pragma mark - Export
+
+- (BOOL)isRunning
+{
+	@synchronized(self) {
+		return _timer != nil;
+	}
+}
+
+- (BOOL)startExportingToFileAtPath:(NSString *)path interval:(NSTimeInterval)interval error:(NSError * __autoreleasing *)error
+{
+	NSString *directory = [path stringByDeletingLastPathComponent];
+	BOOL isDirectory = NO;
+	if (![[NSFileManager defaultManager] fileExistsAtPath:directory isDirectory:&isDirectory] || !isDirectory) {
+		if (error != NULL) {
+			*error = ErrorFromErrno(ENOENT);
+		}
+		return NO;
+	}
+
+	@synchronized(self) {
+		[self stopLocked];
+
+		__weak typeof(self) weakSelf = self;
+		[self startTimerWithInterval:interval handler:^{
+			NSData *metrics = [weakSelf collectMetrics];
+			[metrics writeToFile:path options:NSDataWritingAtomic error:nil];
+		}];
+	}
+	return YES;
+}
+
+- (BOOL)startExportingToSocketAtPath:(NSString *)path interval:(NSTimeInterval)interval error:(NSError * __autoreleasing *)error
+{
+	const char *socketPath = path.fileSystemRepresentation;
+
+	struct sockaddr_un address = {};
+	address.sun_family = AF_UNIX;
+	if (strlen(socketPath) >= sizeof(address.sun_path)) {
+		if (error != NULL) {
+			*error = ErrorFromErrno(ENAMETOOLONG);
+		}
+		return NO;
+	}
+	strncpy(address.sun_path, socketPath, sizeof(address.sun_path) - 1);
+
+	int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (fd < 0) {
+		if (error != NULL) {
+			*error = ErrorFromErrno(errno);
+		}
+		return NO;
+	}
+
+	unlink(socketPath);
+	if (bind(fd, (struct sockaddr *)&address, sizeof(address)) != 0 || listen(fd, SOMAXCONN) != 0) {
+		int code = errno;
+		close(fd);
+		if (error != NULL) {
+			*error = ErrorFromErrno(code);
+		}
+		return NO;
+	}
+	fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+
+	@synchronized(self) {
+		[self stopLocked];
+
+		__weak typeof(self) weakSelf = self;
+		std::string unlinkPath(socketPath);
+
+		_socketSource = dispatch_source_create(DISPATCH_SOURCE_TYPE_READ, fd, 0, _queue);
+		dispatch_source_set_event_handler(_socketSource, ^{
+			[weakSelf acceptClientsOnSocket:fd];
+		});
+		dispatch_source_set_cancel_handler(_socketSource, ^{
+			close(fd);
+			unlink(unlinkPath.c_str());
+		});
+		dispatch_resume(_socketSource);
+
+		[self startTimerWithInterval:interval handler:^{
+			[weakSelf collectMetrics];
+		}];
+	}
+	return YES;
+}
+
+- (void)stop
+{
+	@synchronized(self) {
+		[self stopLocked];
+	}
+}
+
+- (void)stopLocked
+{
+	if (_timer != nil) {
+		dispatch_source_cancel(_timer);
+		_timer = nil;
+	}
+	if (_socketSource != nil) {
+		dispatch_source_cancel(_socketSource);
+		_socketSource = nil;
+	}
+}
+
+- (void)startTimerWithInterval:(NSTimeInterval)interval handler:(dispatch_block_t)handler
+{
+	uint64_t nanoseconds = (uint64_t)(interval * NSEC_PER_SEC);
+
+	_timer = dispatch_source_create(DISPATCH_SOURCE_TYPE_TIMER, 0, 0, _queue);
+	dispatch_source_set_timer(_timer, dispatch_time(DISPATCH_TIME_NOW, 0), nanoseconds, nanoseconds / 10);
+	dispatch_source_set_event_handler(_timer, handler);
+	dispatch_resume(_timer);
+}
+
+- (NSData *)collectMetrics
+{
+	@autoreleasepool {
+		_latestMetrics = [[self prometheusText] dataUsingEncoding:NSUTF8StringEncoding];
+	}
+	return _latestMetrics;
+}
+
+- (void)acceptClientsOnSocket:(int)fd
+{
+	int client;
+	while ((client = accept(fd, NULL, NULL)) >= 0) {
+		NSData *metrics = _latestMetrics ?: [self collectMetrics];
+
+		int on = 1;
+		struct timeval timeout = { .tv_sec = 1, .tv_usec = 0 };
+		fcntl(client, F_SETFL, fcntl(client, F_GETFL) & ~O_NONBLOCK);
+		setsockopt(client, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+		setsockopt(client, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+		const uint8_t *bytes = (const uint8_t *)metrics.bytes;
+		size_t remaining = metrics.length;
+		while (remaining > 0) {
+			ssize_t written = write(client, bytes, remaining);
+			if (written <= 0) {
+				break;
+			}
+			bytes += written;
+			remaining -= written;
+		}
+		close(client);
+	}
+}
+
+#pragma mark - Rendering
+
+- (NSString *)prometheusText
+{
+	NSMutableString *text = [NSMutableString string];
+
+	if (_statistics != nil) {
+		RocksDBStatisticsSnapshot *snapshot = [_statistics snapshot];
+		[self appendTickersOfSnapshot:snapshot toText:text];
+		[self appendHistogramsOfSnapshot:snapshot toText:text];
+	}
+
+	// `-[RocksDB close]` synchronizes on the database, so it can't delete the native
+	// handles while they are being read here
+	@synchronized(_database) {
+		if (!_database.isClosed) {
+			NSMutableArray<RocksDB *> *columnFamilies = [NSMutableArray arrayWithObject:_database];
+			NSMutableArray<RocksDBColumnFamilyMetaData *> *metaData = [NSMutableArray array];
+			NSMutableSet<NSString *> *names = [NSMutableSet set];
+
+			[columnFamilies addObjectsFromArray:[_database columnFamilies]];
+			for (RocksDB *columnFamily in [columnFamilies copy]) {
+				RocksDBColumnFamilyMetaData *columnFamilyMetaData = [columnFamily columnFamilyMetaData];
+				if ([names containsObject:columnFamilyMetaData.name]) {
+					[columnFamilies removeObjectIdenticalTo:columnFamily];
+					continue;
+				}
+				[names addObject:columnFamilyMetaData.name];
+				[metaData addObject:columnFamilyMetaData];
+			}
+
+			[self appendIntPropertiesOfColumnFamilies:columnFamilies metaData:metaData toText:text];
+			[self appendLevelsOfMetaData:metaData toText:text];
+		}
+	}
+
+	return text;
+}
+
+- (void)appendTickersOfSnapshot:(RocksDBStatisticsSnapshot *)snapshot toText:(NSMutableString *)text
+{
+	for (const auto &ticker : rocksdb::TickersNameMap) {
+		NSString *name = [MetricName(ticker.second) stringByAppendingString:@"_total"];
+		[text appendFormat:@"# TYPE %@ counter\n", name];
+		[text appendFormat:@"%@ %llu\n", name, [snapshot countForTicker:(RocksDBTicker)ticker.first]];
+	}
+}
+
+- (void)appendHistogramsOfSnapshot:(RocksDBStatisticsSnapshot *)snapshot toText:(NSMutableString *)text
+{
+	for (const auto &histogram : rocksdb::HistogramsNameMap) {
+		RocksDBStatisticsHistogram *data = [snapshot histogramDataForType:(RocksDBHistogram)histogram.first];
+		NSString *name = MetricName(histogram.second);
+		[text appendFormat:@"# TYPE %@ summary\n", name];
+		[text appendFormat:@"%@{quantile=\"0.5\"} %.15g\n", name, data.median];
+		[text appendFormat:@"%@{quantile=\"0.95\"} %.15g\n", name, data.percentile95];
+		[text appendFormat:@"%@{quantile=\"0.99\"} %.15g\n", name, data.percentile99];
+		[text appendFormat:@"%@{quantile=\"0.999\"} %.15g\n", name, data.percentile999];
+		[text appendFormat:@"%@_sum %llu\n", name, data.sum];
+		[text appendFormat:@"%@_count %llu\n", name, data.count];
+		[text appendFormat:@"# TYPE %@_max gauge\n", name];
+		[text appendFormat:@"%@_max %.15g\n", name, data.max];
+	}
+}
+
+- (void)appendIntPropertiesOfColumnFamilies:(NSArray<RocksDB *> *)columnFamilies
+								   metaData:(NSArray<RocksDBColumnFamilyMetaData *> *)metaData
+									 toText:(NSMutableString *)text
+{
+	for (NSUInteger property = 0; ; property++) {
+		NSString *propertyName = ResolveIntProperty((RocksDBIntProperty)property);
+		if (propertyName.length == 0) {
+			break;
+		}
+
+		NSString *name = MetricName(propertyName.UTF8String);
+		[text appendFormat:@"# TYPE %@ gauge\n", name];
+		for (NSUInteger idx = 0; idx < columnFamilies.count; idx++) {
+			[text appendFormat:@"%@{column_family=\"%@\"} %llu\n",
+			 name, LabelValue(metaData[idx].name), [columnFamilies[idx] valueForIntProperty:(RocksDBIntProperty)property]];
+		}
+	}
+}
+
+- (void)appendLevelsOfMetaData:(NSArray<RocksDBColumnFamilyMetaData *> *)metaData toText:(NSMutableString *)text
+{
+	[text appendString:@"# TYPE rocksdb_level_size_bytes gauge\n"];
+	for (RocksDBColumnFamilyMetaData *columnFamily in metaData) {
+		for (RocksDBLevelFileMetaData *level in columnFamily.levels) {
+			[text appendFormat:@"rocksdb_level_size_bytes{column_family=\"%@\",level=\"%d\"} %llu\n",
+			 LabelValue(columnFamily.name), level.level, level.size];
+		}
+	}
+
+	[text appendString:@"# TYPE rocksdb_level_files gauge\n"];
+	for (RocksDBColumnFamilyMetaData *columnFamily in metaData) {
+		for (RocksDBLevelFileMetaData *level in columnFamily.levels) {
+			[text appendFormat:@"rocksdb_level_files{column_family=\"%@\",level=\"%d\"} %lu\n",
+			 LabelValue(columnFamily.name), level.level, (unsigned long)level.files.count];
+		}
+	}
+
+	[text appendString:@"# TYPE rocksdb_level_compression_ratio gauge\n"];
+	for (RocksDBColumnFamilyMetaData *columnFamily in metaData) {
+		for (RocksDBLevelFileMetaData *level in columnFamily.levels) {
+			// Levels without files report a ratio of -1
+			if (level.compressionRatio < 0) {
+				continue;
+			}
+			[text appendFormat:@"rocksdb_level_compression_ratio{column_family=\"%@\",level=\"%d\"} %.15g\n",
+			 LabelValue(columnFamily.name), level.level, level.compressionRatio];
+		}
+	}
+}
+
+@end
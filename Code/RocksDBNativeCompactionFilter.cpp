@@ -0,0 +1,109 @@
+//
+//  RocksDBNativeCompactionFilter.cpp
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#include "RocksDBNativeCompactionFilter.h"
+
+#include <rocksdb/env.h>
+
+const size_t RocksDBTimestampSuffixLength = sizeof(uint64_t);
+
+void RocksDBAppendTimestampSuffix(std::string* value, uint64_t timestamp)
+{
+	char buffer[sizeof(uint64_t)];
+	for (size_t i = 0; i < sizeof(uint64_t); i++) {
+		buffer[i] = static_cast<char>((timestamp >> (8 * i)) & 0xff);
+	}
+	value->append(buffer, sizeof(uint64_t));
+}
+
+bool RocksDBDecodeTimestampSuffix(const rocksdb::Slice& value, uint64_t* timestamp)
+{
+	if (value.size() < RocksDBTimestampSuffixLength) {
+		return false;
+	}
+
+	const unsigned char* suffix = reinterpret_cast<const unsigned char *>(value.data() + value.size() - RocksDBTimestampSuffixLength);
+	uint64_t result = 0;
+	for (size_t i = 0; i < sizeof(uint64_t); i++) {
+		result |= static_cast<uint64_t>(suffix[i]) << (8 * i);
+	}
+	*timestamp = result;
+	return true;
+}
+
+class RocksDBTimeToLiveCompactionFilterImpl : public rocksdb::CompactionFilter
+{
+private:
+	uint64_t ttl;
+
+public:
+	RocksDBTimeToLiveCompactionFilterImpl(uint64_t ttl): ttl(ttl) {}
+
+	virtual const char* Name() const
+	{
+		return "objectiverocks.ttl";
+	}
+
+	virtual bool Filter(int level,
+						const rocksdb::Slice& key,
+						const rocksdb::Slice& existing_value,
+						std::string* new_value,
+						bool* value_changed) const
+	{
+		uint64_t timestamp = 0;
+		if (!RocksDBDecodeTimestampSuffix(existing_value, &timestamp)) {
+			return false;
+		}
+
+		int64_t now = 0;
+		if (!rocksdb::Env::Default()->GetCurrentTime(&now).ok()) {
+			return false;
+		}
+		// Entries with a timestamp in the future are kept; `timestamp + ttl` could overflow
+		uint64_t current = static_cast<uint64_t>(now);
+		return timestamp <= current && current - timestamp > ttl;
+	}
+};
+
+class RocksDBPrefixDropCompactionFilterImpl : public rocksdb::CompactionFilter
+{
+private:
+	std::vector<std::string> prefixes;
+
+public:
+	RocksDBPrefixDropCompactionFilterImpl(const std::vector<std::string>& prefixes): prefixes(prefixes) {}
+
+	virtual const char* Name() const
+	{
+		return "objectiverocks.prefix.drop";
+	}
+
+	virtual bool Filter(int level,
+						const rocksdb::Slice& key,
+						const rocksdb::Slice& existing_value,
+						std::string* new_value,
+						bool* value_changed) const
+	{
+		for (const auto& prefix : prefixes) {
+			if (key.starts_with(prefix)) {
+				return true;
+			}
+		}
+		return false;
+	}
+};
+
+rocksdb::CompactionFilter* RocksDBTimeToLiveCompactionFilter(uint64_t ttl)
+{
+	return new RocksDBTimeToLiveCompactionFilterImpl(ttl);
+}
+
+rocksdb::CompactionFilter* RocksDBPrefixDropCompactionFilter(const std::vector<std::string>& prefixes)
+{
+	return new RocksDBPrefixDropCompactionFilterImpl(prefixes);
+}
@@ -0,0 +1,32 @@
+//
+//  RocksDBNativeCompactionFilter.h
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#ifndef __ObjectiveRocks__RocksDBNativeCompactionFilter__
+#define __ObjectiveRocks__RocksDBNativeCompactionFilter__
+
+#import <string>
+#import <vector>
+#import <rocksdb/slice.h>
+#import <rocksdb/compaction_filter.h>
+
+/** Length of the timestamp suffix: 64-bit seconds since the Unix epoch, little-endian. */
+extern const size_t RocksDBTimestampSuffixLength;
+
+/** Appends the given timestamp as suffix to the value. */
+extern void RocksDBAppendTimestampSuffix(std::string* value, uint64_t timestamp);
+
+/** Decodes the timestamp suffix of the value, returns false if the value is too short. */
+extern bool RocksDBDecodeTimestampSuffix(const rocksdb::Slice& value, uint64_t* timestamp);
+
+/** Removes entries whose value timestamp suffix is older than `ttl` seconds. */
+extern rocksdb::CompactionFilter* RocksDBTimeToLiveCompactionFilter(uint64_t ttl);
+
+/** Removes entries whose key starts with any of the given prefixes. */
+extern rocksdb::CompactionFilter* RocksDBPrefixDropCompactionFilter(const std::vector<std::string>& prefixes);
+
+#endif /* defined(__ObjectiveRocks__RocksDBNativeCompactionFilter__) */
@@ -0,0 +1,290 @@
+//
+//  RocksDBNativeComparator.cpp
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#include "RocksDBNativeComparator.h"
+
+#include <rocksdb/slice.h>
+
+#include <string>
+
+static uint64_t DecodeBigEndian64(const char* data)
+{
+	const unsigned char* bytes = reinterpret_cast<const unsigned char *>(data);
+	uint64_t value = 0;
+	for (size_t i = 0; i < sizeof(uint64_t); i++) {
+		value = (value << 8) | bytes[i];
+	}
+	return value;
+}
+
+static uint32_t DecodeBigEndian32(const char* data)
+{
+	const unsigned char* bytes = reinterpret_cast<const unsigned char *>(data);
+	return (static_cast<uint32_t>(bytes[0]) << 24) | (static_cast<uint32_t>(bytes[1]) << 16) |
+		(static_cast<uint32_t>(bytes[2]) << 8) | static_cast<uint32_t>(bytes[3]);
+}
+
+static void AppendLengthPrefixed(std::string* dst, const std::string& component)
+{
+	uint32_t length = static_cast<uint32_t>(component.size());
+	char buffer[sizeof(uint32_t)] = {
+		static_cast<char>((length >> 24) & 0xff),
+		static_cast<char>((length >> 16) & 0xff),
+		static_cast<char>((length >> 8) & 0xff),
+		static_cast<char>(length & 0xff)
+	};
+	dst->append(buffer, sizeof(uint32_t));
+	dst->append(component);
+}
+
+template <typename T>
+static int CompareValues(T a, T b)
+{
+	return a < b ? -1 : (a > b ? 1 : 0);
+}
+
+/**
+ Base for comparators over fixed 8-byte keys. Keys of any other length sort after all
+ well-formed keys in bytewise order, which keeps the order total for malformed data.
+ */
+class RocksDBFixed64ComparatorImpl : public rocksdb::Comparator
+{
+protected:
+	virtual int CompareFixed64(const char* a, const char* b) const = 0;
+
+public:
+	virtual int Compare(const rocksdb::Slice& a, const rocksdb::Slice& b) const
+	{
+		bool aIsFixed = a.size() == sizeof(uint64_t);
+		bool bIsFixed = b.size() == sizeof(uint64_t);
+
+		if (aIsFixed && bIsFixed) {
+			return CompareFixed64(a.data(), b.data());
+		} else if (aIsFixed != bIsFixed) {
+			return aIsFixed ? -1 : 1;
+		}
+		return a.compare(b);
+	}
+
+	// Shortening a fixed width key would move it after all well-formed keys, thus keep it as is
+	virtual void FindShortestSeparator(std::string* start,
+									   const rocksdb::Slice& limit) const {}
+
+	virtual void FindShortSuccessor(std::string* key) const {}
+};
+
+class RocksDBUTF8CodePointComparatorImpl : public rocksdb::Comparator
+{
+public:
+	virtual const char* Name() const
+	{
+		return "objectiverocks.utf8.codepoint";
+	}
+
+	virtual int Compare(const rocksdb::Slice& a, const rocksdb::Slice& b) const
+	{
+		// The bytewise order of UTF-8 sequences is their code point order
+		return a.compare(b);
+	}
+
+	// Index keys are never decoded, so bytewise separators are valid even if they split a sequence
+	virtual void FindShortestSeparator(std::string* start,
+									   const rocksdb::Slice& limit) const
+	{
+		rocksdb::BytewiseComparator()->FindShortestSeparator(start, limit);
+	}
+
+	virtual void FindShortSuccessor(std::string* key) const
+	{
+		rocksdb::BytewiseComparator()->FindShortSuccessor(key);
+	}
+};
+
+class RocksDBUInt64BigEndianComparatorImpl : public RocksDBFixed64ComparatorImpl
+{
+protected:
+	virtual int CompareFixed64(const char* a, const char* b) const
+	{
+		return CompareValues(DecodeBigEndian64(a), DecodeBigEndian64(b));
+	}
+
+public:
+	virtual const char* Name() const
+	{
+		return "objectiverocks.uint64.be";
+	}
+};
+
+class RocksDBInt64BigEndianComparatorImpl : public RocksDBFixed64ComparatorImpl
+{
+protected:
+	virtual int CompareFixed64(const char* a, const char* b) const
+	{
+		return CompareValues(static_cast<int64_t>(DecodeBigEndian64(a)), static_cast<int64_t>(DecodeBigEndian64(b)));
+	}
+
+public:
+	virtual const char* Name() const
+	{
+		return "objectiverocks.int64.be";
+	}
+};
+
+class RocksDBDoubleBigEndianComparatorImpl : public RocksDBFixed64ComparatorImpl
+{
+private:
+	static uint64_t TotalOrderBits(const char* data)
+	{
+		// Negative values have all bits flipped, positive ones only the sign bit, so that
+		// -NaN < -Inf < ... < -0.0 < +0.0 < ... < +Inf < +NaN orders as unsigned integers
+		uint64_t bits = DecodeBigEndian64(data);
+		return (bits & 0x8000000000000000ULL) ? ~bits : bits | 0x8000000000000000ULL;
+	}
+
+protected:
+	virtual int CompareFixed64(const char* a, const char* b) const
+	{
+		return CompareValues(TotalOrderBits(a), TotalOrderBits(b));
+	}
+
+public:
+	virtual const char* Name() const
+	{
+		return "objectiverocks.double.be";
+	}
+};
+
+class RocksDBLengthPrefixedComparatorImpl : public rocksdb::Comparator
+{
+public:
+	virtual const char* Name() const
+	{
+		return "objectiverocks.length.prefixed";
+	}
+
+	virtual int Compare(const rocksdb::Slice& a, const rocksdb::Slice& b) const
+	{
+		rocksdb::Slice left = a;
+		rocksdb::Slice right = b;
+
+		while (left.size() >= sizeof(uint32_t) && right.size() >= sizeof(uint32_t)) {
+			uint32_t leftLength = DecodeBigEndian32(left.data());
+			uint32_t rightLength = DecodeBigEndian32(right.data());
+			if (leftLength > left.size() - sizeof(uint32_t) || rightLength > right.size() - sizeof(uint32_t)) {
+				break;
+			}
+
+			rocksdb::Slice leftComponent(left.data() + sizeof(uint32_t), leftLength);
+			rocksdb::Slice rightComponent(right.data() + sizeof(uint32_t), rightLength);
+			int result = leftComponent.compare(rightComponent);
+			if (result != 0) {
+				return result;
+			}
+
+			left.remove_prefix(sizeof(uint32_t) + leftLength);
+			right.remove_prefix(sizeof(uint32_t) + rightLength);
+		}
+
+		// Fewer components sort first, malformed remainders compare bytewise
+		return left.compare(right);
+	}
+
+	virtual void FindShortestSeparator(std::string* start,
+									   const rocksdb::Slice& limit) const
+	{
+		rocksdb::Slice left(*start);
+		rocksdb::Slice right = limit;
+
+		// Skip the leading components shared by both keys
+		while (left.size() >= sizeof(uint32_t) && right.size() >= sizeof(uint32_t)) {
+			uint32_t leftLength = DecodeBigEndian32(left.data());
+			uint32_t rightLength = DecodeBigEndian32(right.data());
+			if (leftLength > left.size() - sizeof(uint32_t) || rightLength > right.size() - sizeof(uint32_t)) {
+				return;
+			}
+
+			rocksdb::Slice leftComponent(left.data() + sizeof(uint32_t), leftLength);
+			rocksdb::Slice rightComponent(right.data() + sizeof(uint32_t), rightLength);
+			if (leftComponent != rightComponent) {
+				// Replace the first differing component with a bytewise separator and drop the rest,
+				// which is only valid if the separator sorts strictly after the original component
+				std::string separator = leftComponent.ToString();
+				rocksdb::BytewiseComparator()->FindShortestSeparator(&separator, rightComponent);
+				if (rocksdb::Slice(separator).compare(leftComponent) <= 0) {
+					return;
+				}
+
+				size_t offset = left.data() - start->data();
+				std::string result = start->substr(0, offset);
+				AppendLengthPrefixed(&result, separator);
+				if (result.size() < start->size()) {
+					start->swap(result);
+				}
+				return;
+			}
+
+			left.remove_prefix(sizeof(uint32_t) + leftLength);
+			right.remove_prefix(sizeof(uint32_t) + rightLength);
+		}
+	}
+
+	virtual void FindShortSuccessor(std::string* key) const
+	{
+		if (key->size() < sizeof(uint32_t)) {
+			return;
+		}
+
+		uint32_t length = DecodeBigEndian32(key->data());
+		if (length > key->size() - sizeof(uint32_t)) {
+			return;
+		}
+
+		// A successor of the first component alone sorts after every key starting with it
+		std::string successor = key->substr(sizeof(uint32_t), length);
+		rocksdb::BytewiseComparator()->FindShortSuccessor(&successor);
+		if (rocksdb::Slice(successor).compare(rocksdb::Slice(key->data() + sizeof(uint32_t), length)) <= 0) {
+			return;
+		}
+
+		std::string result;
+		AppendLengthPrefixed(&result, successor);
+		if (result.size() < key->size()) {
+			key->swap(result);
+		}
+	}
+};
+
+const rocksdb::Comparator* RocksDBUTF8CodePointComparator()
+{
+	static RocksDBUTF8CodePointComparatorImpl comparator;
+	return &comparator;
+}
+
+const rocksdb::Comparator* RocksDBUInt64BigEndianComparator()
+{
+	static RocksDBUInt64BigEndianComparatorImpl comparator;
+	return &comparator;
+}
+
+const rocksdb::Comparator* RocksDBInt64BigEndianComparator()
+{
+	static RocksDBInt64BigEndianComparatorImpl comparator;
+	return &comparator;
+}
+
+const rocksdb::Comparator* RocksDBDoubleBigEndianComparator()
+{
+	static RocksDBDoubleBigEndianComparatorImpl comparator;
+	return &comparator;
+}
+
+const rocksdb::Comparator* RocksDBLengthPrefixedComparator()
+{
+	static RocksDBLengthPrefixedComparatorImpl comparator;
+	return &comparator;
+}
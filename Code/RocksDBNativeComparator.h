@@ -0,0 +1,29 @@
+//
+//  RocksDBNativeComparator.h
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#ifndef __ObjectiveRocks__RocksDBNativeComparator__
+#define __ObjectiveRocks__RocksDBNativeComparator__
+
+#import <rocksdb/comparator.h>
+
+/** Orders UTF-8 encoded keys by their Unicode code points. */
+extern const rocksdb::Comparator* RocksDBUTF8CodePointComparator();
+
+/** Orders 8-byte keys as big-endian unsigned 64-bit integers. */
+extern const rocksdb::Comparator* RocksDBUInt64BigEndianComparator();
+
+/** Orders 8-byte keys as big-endian two's complement signed 64-bit integers. */
+extern const rocksdb::Comparator* RocksDBInt64BigEndianComparator();
+
+/** Orders 8-byte keys as big-endian IEEE 754 doubles, using the IEEE total order. */
+extern const rocksdb::Comparator* RocksDBDoubleBigEndianComparator();
+
+/** Orders composite keys component-wise, each component prefixed with its 32-bit big-endian length. */
+extern const rocksdb::Comparator* RocksDBLengthPrefixedComparator();
+
+#endif /* defined(__ObjectiveRocks__RocksDBNativeComparator__) */
@@ -0,0 +1,44 @@
+//
+//  RocksDBNativeHotKeyTracker.cpp
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#include "RocksDBNativeHotKeyTracker.h"
+
+#include <algorithm>
+
+RocksDBHotKeyTracker::RocksDBHotKeyTracker(size_t capacity) : offeredKeys(0), capacity(std::max<size_t>(capacity, 1)), next(0)
+{
+	keys.reserve(this->capacity);
+}
+
+void RocksDBHotKeyTracker::Offer(const rocksdb::Slice& key)
+{
+	if ((offeredKeys.fetch_add(1, std::memory_order_relaxed) + 1) % kSampleRate != 0) {
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(mutex);
+	if (keys.size() < capacity) {
+		keys.push_back(key.ToString());
+	} else {
+		keys[next].assign(key.data(), key.size());
+		next = (next + 1) % capacity;
+	}
+}
+
+std::vector<std::string> RocksDBHotKeyTracker::Keys()
+{
+	std::vector<std::string> result;
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		result = keys;
+	}
+
+	std::sort(result.begin(), result.end());
+	result.erase(std::unique(result.begin(), result.end()), result.end());
+	return result;
+}
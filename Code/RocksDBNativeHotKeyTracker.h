@@ -0,0 +1,45 @@
+//
+//  RocksDBNativeHotKeyTracker.h
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#ifndef __ObjectiveRocks__RocksDBNativeHotKeyTracker__
+#define __ObjectiveRocks__RocksDBNativeHotKeyTracker__
+
+#import <rocksdb/slice.h>
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ Samples the keys of point lookups into a ring buffer of `capacity` keys, so that the most recently
+ read hot keys can be persisted and their blocks reloaded after a restart. Only every `kSampleRate`-th
+ key offered to the tracker is recorded, hence frequently read keys dominate the buffer.
+ */
+class RocksDBHotKeyTracker
+{
+public:
+	static const unsigned kSampleRate = 16;
+
+	explicit RocksDBHotKeyTracker(size_t capacity);
+
+	/** @brief Offers the key of a point lookup. */
+	void Offer(const rocksdb::Slice& key);
+
+	/** @brief Returns the distinct recorded keys in ascending bytewise order. */
+	std::vector<std::string> Keys();
+
+private:
+	std::atomic<unsigned> offeredKeys;
+	std::mutex mutex;
+	std::vector<std::string> keys;
+	size_t capacity;
+	size_t next;
+};
+
+#endif /* defined(__ObjectiveRocks__RocksDBNativeHotKeyTracker__) */
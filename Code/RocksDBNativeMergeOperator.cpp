@@ -0,0 +1,163 @@
+//
+//  RocksDBNativeMergeOperator.cpp
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#include "RocksDBNativeMergeOperator.h"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+static uint64_t DecodeUInt64(const rocksdb::Slice& slice)
+{
+	uint64_t value = 0;
+	if (slice.size() == sizeof(uint64_t)) {
+		memcpy(&value, slice.data(), sizeof(uint64_t));
+	}
+	return value;
+}
+
+static void EncodeUInt64(uint64_t value, std::string* dst)
+{
+	dst->assign(reinterpret_cast<const char *>(&value), sizeof(uint64_t));
+}
+
+class RocksDBUInt64AddMergeOperatorImpl : public rocksdb::MergeOperator
+{
+public:
+	virtual const char* Name() const
+	{
+		return "objectiverocks.uint64add";
+	}
+
+	virtual bool FullMergeV2(const rocksdb::MergeOperator::MergeOperationInput& merge_in,
+							 rocksdb::MergeOperator::MergeOperationOutput* merge_out) const
+	{
+		uint64_t sum = merge_in.existing_value != nullptr ? DecodeUInt64(*merge_in.existing_value) : 0;
+		for (const auto& operand : merge_in.operand_list) {
+			sum += DecodeUInt64(operand);
+		}
+		EncodeUInt64(sum, &merge_out->new_value);
+		return true;
+	}
+
+	virtual bool PartialMergeMulti(const rocksdb::Slice& key,
+								   const std::deque<rocksdb::Slice>& operand_list,
+								   std::string* new_value,
+								   rocksdb::Logger* logger) const
+	{
+		uint64_t sum = 0;
+		for (const auto& operand : operand_list) {
+			sum += DecodeUInt64(operand);
+		}
+		EncodeUInt64(sum, new_value);
+		return true;
+	}
+
+	virtual bool AllowSingleOperand() const
+	{
+		return true;
+	}
+};
+
+class RocksDBMaxMergeOperatorImpl : public rocksdb::MergeOperator
+{
+public:
+	virtual const char* Name() const
+	{
+		return "objectiverocks.max";
+	}
+
+	virtual bool FullMergeV2(const rocksdb::MergeOperator::MergeOperationInput& merge_in,
+							 rocksdb::MergeOperator::MergeOperationOutput* merge_out) const
+	{
+		rocksdb::Slice max;
+		if (merge_in.existing_value != nullptr) {
+			max = *merge_in.existing_value;
+		}
+		for (const auto& operand : merge_in.operand_list) {
+			if (max.compare(operand) < 0) {
+				max = operand;
+			}
+		}
+		merge_out->new_value.assign(max.data(), max.size());
+		return true;
+	}
+
+	virtual bool PartialMergeMulti(const rocksdb::Slice& key,
+								   const std::deque<rocksdb::Slice>& operand_list,
+								   std::string* new_value,
+								   rocksdb::Logger* logger) const
+	{
+		rocksdb::Slice max;
+		for (const auto& operand : operand_list) {
+			if (max.compare(operand) < 0) {
+				max = operand;
+			}
+		}
+		new_value->assign(max.data(), max.size());
+		return true;
+	}
+
+	virtual bool AllowSingleOperand() const
+	{
+		return true;
+	}
+};
+
+class RocksDBPutMergeOperatorImpl : public rocksdb::MergeOperator
+{
+public:
+	virtual const char* Name() const
+	{
+		return "objectiverocks.put";
+	}
+
+	virtual bool FullMergeV2(const rocksdb::MergeOperator::MergeOperationInput& merge_in,
+							 rocksdb::MergeOperator::MergeOperationOutput* merge_out) const
+	{
+		if (merge_in.operand_list.empty()) {
+			return false;
+		}
+		merge_out->existing_operand = merge_in.operand_list.back();
+		return true;
+	}
+
+	virtual bool PartialMergeMulti(const rocksdb::Slice& key,
+								   const std::deque<rocksdb::Slice>& operand_list,
+								   std::string* new_value,
+								   rocksdb::Logger* logger) const
+	{
+		new_value->assign(operand_list.back().data(), operand_list.back().size());
+		return true;
+	}
+
+	virtual bool AllowSingleOperand() const
+	{
+		return true;
+	}
+
+	virtual bool ShouldMerge(const std::vector<rocksdb::Slice>& operands) const
+	{
+		return !operands.empty();
+	}
+};
+
+rocksdb::MergeOperator* RocksDBUInt64AddMergeOperator()
+{
+	return new RocksDBUInt64AddMergeOperatorImpl();
+}
+
+rocksdb::MergeOperator* RocksDBMaxMergeOperator()
+{
+	return new RocksDBMaxMergeOperatorImpl();
+}
+
+rocksdb::MergeOperator* RocksDBPutMergeOperator()
+{
+	return new RocksDBPutMergeOperatorImpl();
+}
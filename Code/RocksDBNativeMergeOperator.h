@@ -0,0 +1,23 @@
+//
+//  RocksDBNativeMergeOperator.h
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#ifndef __ObjectiveRocks__RocksDBNativeMergeOperator__
+#define __ObjectiveRocks__RocksDBNativeMergeOperator__
+
+#import <rocksdb/merge_operator.h>
+
+/** Adds operands interpreted as 64-bit unsigned integers in native byte order. */
+extern rocksdb::MergeOperator* RocksDBUInt64AddMergeOperator();
+
+/** Keeps the bytewise largest of the existing value and all operands. */
+extern rocksdb::MergeOperator* RocksDBMaxMergeOperator();
+
+/** Keeps the most recent operand, reads stop at the newest operand. */
+extern rocksdb::MergeOperator* RocksDBPutMergeOperator();
+
+#endif /* defined(__ObjectiveRocks__RocksDBNativeMergeOperator__) */
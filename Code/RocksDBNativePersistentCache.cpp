@@ -0,0 +1,88 @@
+//
+//  RocksDBNativePersistentCache.cpp
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#include "RocksDBNativePersistentCache.h"
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+
+class RocksDBSecondAccessPersistentCacheImpl : public rocksdb::PersistentCache
+{
+private:
+	std::shared_ptr<rocksdb::PersistentCache> cache;
+	size_t capacity;
+
+	std::mutex mutex;
+	std::unordered_set<size_t> seen;
+	std::atomic<uint64_t> admitted;
+	std::atomic<uint64_t> rejected;
+
+	// Returns true if the key was seen before, otherwise remembers it
+	bool CheckAndRemember(const rocksdb::Slice& key)
+	{
+		size_t hash = std::hash<std::string>()(key.ToString());
+
+		std::lock_guard<std::mutex> lock(mutex);
+		if (seen.erase(hash) > 0) {
+			return true;
+		}
+		if (seen.size() >= capacity) {
+			seen.clear();
+		}
+		seen.insert(hash);
+		return false;
+	}
+
+public:
+	RocksDBSecondAccessPersistentCacheImpl(std::shared_ptr<rocksdb::PersistentCache> cache, size_t capacity)
+	: cache(cache), capacity(capacity), admitted(0), rejected(0) {}
+
+	rocksdb::Status Insert(const rocksdb::Slice& key, const char* data, const size_t size) override
+	{
+		if (!CheckAndRemember(key)) {
+			rejected++;
+			return rocksdb::Status::OK();
+		}
+		admitted++;
+		return cache->Insert(key, data, size);
+	}
+
+	rocksdb::Status Lookup(const rocksdb::Slice& key, std::unique_ptr<char[]>* data, size_t* size) override
+	{
+		return cache->Lookup(key, data, size);
+	}
+
+	bool IsCompressed() override
+	{
+		return cache->IsCompressed();
+	}
+
+	StatsType Stats() override
+	{
+		StatsType stats = cache->Stats();
+		std::map<std::string, double> admission;
+		admission["objectiverocks.admission.admitted"] = admitted.load();
+		admission["objectiverocks.admission.rejected"] = rejected.load();
+		stats.push_back(admission);
+		return stats;
+	}
+
+	std::string GetPrintableOptions() const override
+	{
+		return "SecondAccessPersistentCache(" + cache->GetPrintableOptions() + ")";
+	}
+};
+
+std::shared_ptr<rocksdb::PersistentCache> RocksDBSecondAccessPersistentCache(std::shared_ptr<rocksdb::PersistentCache> cache,
+																			size_t capacity)
+{
+	return std::make_shared<RocksDBSecondAccessPersistentCacheImpl>(cache, capacity);
+}
@@ -0,0 +1,22 @@
+//
+//  RocksDBNativePersistentCache.h
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#ifndef __ObjectiveRocks__RocksDBNativePersistentCache__
+#define __ObjectiveRocks__RocksDBNativePersistentCache__
+
+#import <rocksdb/persistent_cache.h>
+
+/**
+ Wraps a persistent cache and admits a block only on its second insertion, i.e. the second time it is read
+ from a table file, so that blocks read once by scans don't evict the frequently read ones. The keys of
+ blocks seen once are tracked by hash in a set bounded to `capacity` entries.
+ */
+extern std::shared_ptr<rocksdb::PersistentCache> RocksDBSecondAccessPersistentCache(std::shared_ptr<rocksdb::PersistentCache> cache,
+																				   size_t capacity);
+
+#endif /* defined(__ObjectiveRocks__RocksDBNativePersistentCache__) */
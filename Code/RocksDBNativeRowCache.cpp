@@ -0,0 +1,175 @@
+//
+//  RocksDBNativeRowCache.cpp
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#include "RocksDBNativeRowCache.h"
+
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+
+// Identifies the counting cache before it is downcast in RocksDBRowCacheCountersForColumnFamily,
+// thus it must not be used by any other cache
+static const char * const kCountingRowCacheName = "objectiverocks.counting.row.cache";
+
+static thread_local RocksDBRowCacheCounters *currentCounters = nullptr;
+
+class RocksDBCountingRowCacheImpl : public rocksdb::Cache
+{
+private:
+	std::shared_ptr<rocksdb::Cache> cache;
+
+	std::mutex mutex;
+	std::map<uint32_t, std::unique_ptr<RocksDBRowCacheCounters>> counters;
+
+public:
+	RocksDBCountingRowCacheImpl(std::shared_ptr<rocksdb::Cache> cache) : cache(cache) {}
+
+	RocksDBRowCacheCounters * CountersForColumnFamily(uint32_t columnFamilyId)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		std::unique_ptr<RocksDBRowCacheCounters> &entry = counters[columnFamilyId];
+		if (entry == nullptr) {
+			entry.reset(new RocksDBRowCacheCounters());
+		}
+		return entry.get();
+	}
+
+	const char* Name() const override
+	{
+		return kCountingRowCacheName;
+	}
+
+	rocksdb::Status Insert(const rocksdb::Slice& key, void* value, size_t charge,
+						   void (*deleter)(const rocksdb::Slice& key, void* value),
+						   Handle** handle, Priority priority) override
+	{
+		return cache->Insert(key, value, charge, deleter, handle, priority);
+	}
+
+	Handle* Lookup(const rocksdb::Slice& key, rocksdb::Statistics* stats) override
+	{
+		Handle *handle = cache->Lookup(key, stats);
+		RocksDBRowCacheCounters *current = currentCounters;
+		if (current != nullptr) {
+			(handle != nullptr ? current->hits : current->misses).fetch_add(1, std::memory_order_relaxed);
+		}
+		return handle;
+	}
+
+	bool Ref(Handle* handle) override
+	{
+		return cache->Ref(handle);
+	}
+
+	bool Release(Handle* handle, bool force_erase) override
+	{
+		return cache->Release(handle, force_erase);
+	}
+
+	void* Value(Handle* handle) override
+	{
+		return cache->Value(handle);
+	}
+
+	void Erase(const rocksdb::Slice& key) override
+	{
+		cache->Erase(key);
+	}
+
+	uint64_t NewId() override
+	{
+		return cache->NewId();
+	}
+
+	void SetCapacity(size_t capacity) override
+	{
+		cache->SetCapacity(capacity);
+	}
+
+	void SetStrictCapacityLimit(bool strict_capacity_limit) override
+	{
+		cache->SetStrictCapacityLimit(strict_capacity_limit);
+	}
+
+	bool HasStrictCapacityLimit() const override
+	{
+		return cache->HasStrictCapacityLimit();
+	}
+
+	size_t GetCapacity() const override
+	{
+		return cache->GetCapacity();
+	}
+
+	size_t GetUsage() const override
+	{
+		return cache->GetUsage();
+	}
+
+	size_t GetUsage(Handle* handle) const override
+	{
+		return cache->GetUsage(handle);
+	}
+
+	size_t GetPinnedUsage() const override
+	{
+		return cache->GetPinnedUsage();
+	}
+
+	void DisownData() override
+	{
+		cache->DisownData();
+	}
+
+	void ApplyToAllCacheEntries(void (*callback)(void*, size_t), bool thread_safe) override
+	{
+		cache->ApplyToAllCacheEntries(callback, thread_safe);
+	}
+
+	void EraseUnRefEntries() override
+	{
+		cache->EraseUnRefEntries();
+	}
+
+	std::string GetPrintableOptions() const override
+	{
+		return cache->GetPrintableOptions();
+	}
+};
+
+std::shared_ptr<rocksdb::Cache> RocksDBCountingRowCache(std::shared_ptr<rocksdb::Cache> cache)
+{
+	return std::make_shared<RocksDBCountingRowCacheImpl>(cache);
+}
+
+RocksDBRowCacheCounters * RocksDBRowCacheCountersForColumnFamily(rocksdb::DB *db,
+																  rocksdb::ColumnFamilyHandle *columnFamily)
+{
+	if (db == nullptr || columnFamily == nullptr) {
+		return nullptr;
+	}
+
+	std::shared_ptr<rocksdb::Cache> rowCache = db->GetDBOptions().row_cache;
+	if (rowCache == nullptr || strcmp(rowCache->Name(), kCountingRowCacheName) != 0) {
+		return nullptr;
+	}
+
+	auto countingCache = static_cast<RocksDBCountingRowCacheImpl *>(rowCache.get());
+	return countingCache->CountersForColumnFamily(columnFamily->GetID());
+}
+
+RocksDBRowCacheScope::RocksDBRowCacheScope(RocksDBRowCacheCounters *counters) : previous(currentCounters)
+{
+	currentCounters = counters;
+}
+
+RocksDBRowCacheScope::~RocksDBRowCacheScope()
+{
+	currentCounters = previous;
+}
@@ -0,0 +1,53 @@
+//
+//  RocksDBNativeRowCache.h
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#ifndef __ObjectiveRocks__RocksDBNativeRowCache__
+#define __ObjectiveRocks__RocksDBNativeRowCache__
+
+#import <rocksdb/cache.h>
+#import <rocksdb/db.h>
+
+#include <atomic>
+
+/** @brief The row cache hits and misses of a single Column Family. */
+struct RocksDBRowCacheCounters
+{
+	std::atomic<uint64_t> hits;
+	std::atomic<uint64_t> misses;
+
+	RocksDBRowCacheCounters() : hits(0), misses(0) {}
+};
+
+/**
+ Wraps a cache to be used as a row cache. Lookups made within a `RocksDBRowCacheScope` are counted
+ as hits or misses of the scope's counters, all other calls are forwarded as is.
+ */
+extern std::shared_ptr<rocksdb::Cache> RocksDBCountingRowCache(std::shared_ptr<rocksdb::Cache> cache);
+
+/**
+ Returns the counters of the given Column Family, or nullptr if the database has no row cache
+ created via `RocksDBCountingRowCache`. The counters live as long as the database's row cache.
+ */
+extern RocksDBRowCacheCounters * RocksDBRowCacheCountersForColumnFamily(rocksdb::DB *db,
+																		 rocksdb::ColumnFamilyHandle *columnFamily);
+
+/**
+ Attributes the row cache lookups made on the current thread to the given counters, until the
+ scope is left. A nullptr disables counting.
+ */
+class RocksDBRowCacheScope
+{
+public:
+	explicit RocksDBRowCacheScope(RocksDBRowCacheCounters *counters);
+	~RocksDBRowCacheScope();
+
+private:
+	RocksDBRowCacheCounters *previous;
+};
+
+#endif /* defined(__ObjectiveRocks__RocksDBNativeRowCache__) */
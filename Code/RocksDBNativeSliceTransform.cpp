@@ -0,0 +1,86 @@
+//
+//  RocksDBNativeSliceTransform.cpp
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#include "RocksDBNativeSliceTransform.h"
+
+#include <rocksdb/slice.h>
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+class RocksDBDelimiterPrefixTransformImpl : public rocksdb::SliceTransform
+{
+private:
+	char delimiter;
+	size_t count;
+	std::string name;
+
+	// Returns the length of the prefix ending with the count-th delimiter, or 0 if there is none
+	size_t PrefixLength(const rocksdb::Slice& src) const
+	{
+		const char* data = src.data();
+		size_t remaining = src.size();
+		size_t found = 0;
+
+		while (remaining > 0) {
+			const char* match = static_cast<const char *>(memchr(data, delimiter, remaining));
+			if (match == nullptr) {
+				break;
+			}
+			size_t length = match - src.data() + 1;
+			if (++found == count) {
+				return length;
+			}
+			data = match + 1;
+			remaining = src.size() - length;
+		}
+		return 0;
+	}
+
+public:
+	RocksDBDelimiterPrefixTransformImpl(char delimiter, size_t count):
+	delimiter(delimiter), count(count)
+	{
+		// The name is persisted in the table properties, so that filters built with a
+		// different delimiter or count are never consulted for prefix lookups
+		char suffix[32];
+		snprintf(suffix, sizeof(suffix), ".%02x.%zu", static_cast<unsigned char>(delimiter), count);
+		name = std::string("objectiverocks.delimiter.prefix") + suffix;
+	}
+
+	virtual const char* Name() const
+	{
+		return name.c_str();
+	}
+
+	virtual rocksdb::Slice Transform(const rocksdb::Slice& src) const
+	{
+		return rocksdb::Slice(src.data(), PrefixLength(src));
+	}
+
+	virtual bool InDomain(const rocksdb::Slice& src) const
+	{
+		return PrefixLength(src) > 0;
+	}
+
+	virtual bool InRange(const rocksdb::Slice& dst) const
+	{
+		return dst.size() > 0 && PrefixLength(dst) == dst.size();
+	}
+
+	virtual bool SameResultWhenAppended(const rocksdb::Slice& prefix) const
+	{
+		return InRange(prefix);
+	}
+};
+
+rocksdb::SliceTransform* RocksDBDelimiterPrefixTransform(char delimiter, size_t count)
+{
+	return new RocksDBDelimiterPrefixTransformImpl(delimiter, count == 0 ? 1 : count);
+}
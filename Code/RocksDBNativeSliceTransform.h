@@ -0,0 +1,20 @@
+//
+//  RocksDBNativeSliceTransform.h
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#ifndef __ObjectiveRocks__RocksDBNativeSliceTransform__
+#define __ObjectiveRocks__RocksDBNativeSliceTransform__
+
+#import <rocksdb/slice_transform.h>
+
+/**
+ Extracts the prefix of a key up to and including the `count`-th occurrence of the delimiter.
+ Keys containing fewer delimiters are out of the transform's domain.
+ */
+extern rocksdb::SliceTransform* RocksDBDelimiterPrefixTransform(char delimiter, size_t count);
+
+#endif /* defined(__ObjectiveRocks__RocksDBNativeSliceTransform__) */
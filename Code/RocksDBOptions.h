@@ -12,7 +12,9 @@
 
 @class RocksDBComparator;
 @class RocksDBMergeOperator;
+@class RocksDBCompactionFilter;
 @class RocksDBPrefixExtractor;
+@class RocksDBCompressionOptions;
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -36,6 +38,25 @@ NS_ASSUME_NONNULL_BEGIN
 - (instancetype)initWithDatabaseOptions:(RocksDBDatabaseOptions *)dbOptions
 				 andColumnFamilyOptions:(RocksDBColumnFamilyOptions *)columnFamilyOptions;
 
+#if !(defined(ROCKSDB_LITE) && defined(TARGET_OS_IPHONE))
+/**
+ Configures the options for a dataset that fits entirely in memory, e.g. on a RAM disk
+ or in the OS page cache, and is mostly read with point lookups and prefix seeks.
+
+ @discussion The table files are read via mmap and use the `PlainTable` format with a
+ hash-based prefix index, which is stored in the files. Plain tables don't use a block cache,
+ so no block decoding or cache lookups happen on reads. All table files are kept open.
+ Seeks with keys whose prefix differs from the target's aren't supported.
+
+ @param prefixExtractor The prefix extractor used to build the hash index.
+
+ @see RocksDBPlainTableOptions
+
+ @warning Not available in RocksDB Lite.
+ */
+- (void)optimizeForInMemoryLookupsWithPrefixExtractor:(RocksDBPrefixExtractor *)prefixExtractor;
+#endif
+
 @end
 
 #pragma mark - DB Options
@@ -77,6 +98,14 @@ NS_ASSUME_NONNULL_BEGIN
  The default is 0. */
 @property (nonatomic, assign) uint64_t maxWriteAheadLogSize;
 
+/** @brief If non-nil, the memtables' memory is accounted to the given manager, which
+ enforces a memory budget across all column families and database instances it is shared with.
+ The default is nil.
+
+ @see RocksDBWriteBufferManager
+ */
+@property (nonatomic, strong, nullable) RocksDBWriteBufferManager *writeBufferManager;
+
 #if !(defined(ROCKSDB_LITE) && defined(TARGET_OS_IPHONE))
 /** @brief If non-nil, metrics about database operations will be collected.
  Statistics objects should not be shared between DB instances. 
@@ -85,6 +114,31 @@ NS_ASSUME_NONNULL_BEGIN
  @see RocksDBStatistics
  */
 @property (nonatomic, strong, nullable) RocksDBStatistics *statistics;
+/** @brief Listeners to be notified about flushes, compactions, write stalls and table files.
+ The default is nil.
+
+ @see RocksDBEventListener
+ */
+@property (nonatomic, copy, nullable) NSArray<RocksDBEventListener *> *listeners;
+/** @brief If non-nil, the values of point lookups are cached in the given cache, so that
+ lookups on hot keys don't search the memtables, index and data blocks. The lookups served by the
+ row cache are counted per Column Family, see `-[RocksDB rowCacheHitCount]`.
+ The default is nil.
+
+ @see RocksDBCache
+ */
+@property (nonatomic, strong, nullable) RocksDBCache *rowCache;
+/** @brief If non-nil, the block cache of the default Column Family is warmed up in the background
+ from the hot keys file at this path right after the database is opened, and the keys sampled since
+ `-[RocksDB startTrackingHotKeysWithCapacity:]` are dumped to it when the database is closed.
+ A missing file is ignored. Closing the database cancels a running warm-up.
+ Only keys tracked on the default Column Family's `RocksDB` instance are covered, keys tracked on a
+ `RocksDBColumnFamily` are not dumped and must be dumped and warmed up manually.
+ The default is nil.
+
+ @see -[RocksDB warmUpBlockCacheFromHotKeysFileAtPath:completion:]
+ */
+@property (nonatomic, copy, nullable) NSString *hotKeysFilePath;
 #endif
 
 /** @brief If true, then the contents of manifest and data files are not 
@@ -96,6 +150,15 @@ NS_ASSUME_NONNULL_BEGIN
  The default is false. */
 @property (nonatomic, assign) BOOL useFSync;
 
+/** @brief If true, table files are read via mmap instead of read calls, which
+ avoids copying the data for datasets that fit in memory.
+ The default is false. */
+@property (nonatomic, assign) BOOL allowMmapReads;
+
+/** @brief If true, files are written via mmap instead of write calls.
+ The default is false. */
+@property (nonatomic, assign) BOOL allowMmapWrites;
+
 /** @brief Specify the maximal size of the info log file. If maxLogFileSize == 0,
  all logs will be written to one log file.
  The default is 0. */
@@ -114,6 +177,13 @@ NS_ASSUME_NONNULL_BEGIN
  The default is 0. */
 @property (nonatomic, assign) uint64_t bytesPerSync;
 
+/** @brief Maximum number of threads a single compaction job is split into, each of
+ them writing a disjoint key range of the output. Only compactions starting at L0 and
+ manual compactions are split, while automatic compactions into the lower levels,
+ including the bottommost one, always run in a single thread.
+ The default is 1 (no subcompactions). */
+@property (nonatomic, assign) uint32_t maxSubcompactions;
+
 @end
 
 #pragma mark - Column Family Options
@@ -143,6 +213,14 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (nonatomic, strong, nullable) RocksDBMergeOperator *mergeOperator;
 
+/** @brief A single compaction filter, which is consulted for every entry during
+ compaction and can remove it, e.g. expired records.
+ Default: nil
+
+ @see RocksDBCompactionFilter
+ */
+@property (nonatomic, strong, nullable) RocksDBCompactionFilter *compactionFilter;
+
 /** @brief Amount of data to build up in memory (backed by an unsorted log
  on disk) before converting to a sorted on-disk file.
  Default: 4MB.
@@ -165,6 +243,33 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (nonatomic, assign) RocksDBCompressionType compressionType;
 
+/** @brief Different compression algorithms for the different levels, as an array of
+ `RocksDBCompressionType` values. If non-empty, it overrides `compressionType` and must
+ have one entry per level, e.g. no compression for L0 and L1, LZ4 for the middle levels
+ and zstd for the larger ones. A shorter array is padded with its last entry.
+ Default: empty
+ */
+@property (nonatomic, copy) NSArray<NSNumber *> *compressionPerLevel;
+
+/** @brief Options for the compression algorithm, e.g. the zstd level and dictionary size.
+
+ @see RocksDBCompressionOptions
+ */
+@property (nonatomic, strong, nullable) RocksDBCompressionOptions *compressionOptions;
+
+/** @brief Compression algorithm for the bottommost level, which holds most of the data and
+ is rewritten least often, thus favoring a stronger algorithm than the other levels.
+ Default: RocksDBCompressionDisabled, i.e. the bottommost level is compressed like the others.
+ */
+@property (nonatomic, assign) RocksDBCompressionType bottommostCompressionType;
+
+/** @brief Options for the bottommost compression algorithm. Only used if `enabled` is set,
+ otherwise `compressionOptions` applies to the bottommost level as well.
+
+ @see RocksDBCompressionOptions
+ */
+@property (nonatomic, strong, nullable) RocksDBCompressionOptions *bottommostCompressionOptions;
+
 /** @brief If non-nil, the specified function to determine the
  prefixes for keys will be used. These prefixes will be placed in the filter.
 
@@ -11,6 +11,7 @@
 #import "RocksDBComparator.h"
 #import "RocksDBMergeOperator.h"
 #import "RocksDBPrefixExtractor.h"
+#import "RocksDBTableFactory.h"
 
 #import <rocksdb/options.h>
 #import <rocksdb/comparator.h>
@@ -69,6 +70,24 @@
 	return rocksdb::Options(_databaseOptions.options, _columnFamilyOption.options);
 }
 
+#pragma mark - Profiles
+
+#if !(defined(ROCKSDB_LITE) && defined(TARGET_OS_IPHONE))
+- (void)optimizeForInMemoryLookupsWithPrefixExtractor:(RocksDBPrefixExtractor *)prefixExtractor
+{
+	_databaseOptions.allowMmapReads = YES;
+	_databaseOptions.maxOpenFiles = -1;
+
+	_columnFamilyOption.prefixExtractor = prefixExtractor;
+	_columnFamilyOption.tableFacotry = [RocksDBTableFactory plainTableFactoryWithOptions:^(RocksDBPlainTableOptions *options) {
+		options.bloomBitsPerKey = 10;
+		options.hashTableRatio = 0.75;
+		options.encodingType = PlainTableEncodingPlain;
+		options.storeIndexInFile = YES;
+	}];
+}
+#endif
+
 #pragma mark - Forward
 
 - (id)forwardingTargetForSelector:(SEL)aSelector
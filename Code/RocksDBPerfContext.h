@@ -0,0 +1,273 @@
+//
+//  RocksDBPerfContext.h
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** @brief The level of per-operation profiling, which applies to the calling thread only. */
+typedef NS_ENUM(int, RocksDBPerfLevel)
+{
+	/** @brief Disable perf stats. */
+	RocksDBPerfLevelDisable = 1,
+
+	/** @brief Enable only count stats. */
+	RocksDBPerfLevelEnableCount = 2,
+
+	/** @brief Enable count stats and time stats, except for mutexes. */
+	RocksDBPerfLevelEnableTimeExceptForMutex = 3,
+
+	/** @brief Enable count stats, time stats and CPU time stats, except for mutexes. */
+	RocksDBPerfLevelEnableTimeAndCPUTimeExceptForMutex = 4,
+
+	/** @brief Enable all count and time stats. */
+	RocksDBPerfLevelEnableTime = 5
+};
+
+/**
+ `RocksDBPerfContext` exposes RocksDB's thread-local `PerfContext` and `IOStatsContext` counters,
+ which break down where the time of individual operations on the calling thread went.
+
+ @discussion Profiling is disabled by default. Set a perf level, reset the counters before the operation
+ of interest and capture the current context afterwards, or use `contextByMeasuringBlock:withPerfLevel:`
+ to do all three at once. Time counters are only collected with any of the `EnableTime` levels and
+ add some overhead to each operation.
+
+ @warning All class methods operate on the counters of the calling thread.
+ */
+@interface RocksDBPerfContext : NSObject
+
+/**
+ Returns the perf level of the calling thread.
+
+ @return The current perf level.
+ */
++ (RocksDBPerfLevel)perfLevel;
+
+/**
+ Sets the perf level of the calling thread.
+
+ @param level The new perf level.
+ */
++ (void)setPerfLevel:(RocksDBPerfLevel)level;
+
+/** @brief Resets all perf and IO stats counters of the calling thread. */
++ (void)reset;
+
+/**
+ Captures the current values of the perf and IO stats counters of the calling thread.
+
+ @return A new perf context holding the counters' values.
+ */
++ (RocksDBPerfContext *)currentContext;
+
+/**
+ Runs the given block on the calling thread with the given perf level and fresh counters,
+ and captures the counters afterwards. The previous perf level is restored.
+
+ @param block The block performing the operations to profile.
+ @param level The perf level to use while running the block.
+ @return A new perf context holding the counters collected while running the block.
+ */
++ (RocksDBPerfContext *)contextByMeasuringBlock:(void (^)(void))block withPerfLevel:(RocksDBPerfLevel)level;
+
+#pragma mark - Perf Context
+
+/** @brief Total number of user key comparisons. */
+@property (nonatomic, assign, readonly) uint64_t userKeyComparisonCount;
+
+/** @brief Total number of block cache hits. */
+@property (nonatomic, assign, readonly) uint64_t blockCacheHitCount;
+
+/** @brief Total number of block reads (with IO). */
+@property (nonatomic, assign, readonly) uint64_t blockReadCount;
+
+/** @brief Total number of bytes from block reads. */
+@property (nonatomic, assign, readonly) uint64_t blockReadByte;
+
+/** @brief Total nanos spent on block reads. */
+@property (nonatomic, assign, readonly) uint64_t blockReadTime;
+
+/** @brief Total nanos spent on block checksum. */
+@property (nonatomic, assign, readonly) uint64_t blockChecksumTime;
+
+/** @brief Total nanos spent on block decompression. */
+@property (nonatomic, assign, readonly) uint64_t blockDecompressTime;
+
+/** @brief Bytes for values returned by Get. */
+@property (nonatomic, assign, readonly) uint64_t getReadBytes;
+
+/** @brief Bytes for values returned by MultiGet. */
+@property (nonatomic, assign, readonly) uint64_t multigetReadBytes;
+
+/** @brief Bytes for keys and values returned by iterators. */
+@property (nonatomic, assign, readonly) uint64_t iterReadBytes;
+
+/** @brief Total number of internal keys skipped over during iteration. */
+@property (nonatomic, assign, readonly) uint64_t internalKeySkippedCount;
+
+/** @brief Total number of deletes and single deletes skipped over during iteration. */
+@property (nonatomic, assign, readonly) uint64_t internalDeleteSkippedCount;
+
+/** @brief Number of internal keys skipped because their sequence number is newer than the snapshot. */
+@property (nonatomic, assign, readonly) uint64_t internalRecentSkippedCount;
+
+/** @brief Number of merge operands passed to the merge operator while reading. */
+@property (nonatomic, assign, readonly) uint64_t internalMergeCount;
+
+/** @brief Total nanos spent on getting the snapshot. */
+@property (nonatomic, assign, readonly) uint64_t getSnapshotTime;
+
+/** @brief Total nanos spent on querying memtables. */
+@property (nonatomic, assign, readonly) uint64_t getFromMemtableTime;
+
+/** @brief Number of memtables queried. */
+@property (nonatomic, assign, readonly) uint64_t getFromMemtableCount;
+
+/** @brief Total nanos spent after Get() finds a key. */
+@property (nonatomic, assign, readonly) uint64_t getPostProcessTime;
+
+/** @brief Total nanos spent reading from output files. */
+@property (nonatomic, assign, readonly) uint64_t getFromOutputFilesTime;
+
+/** @brief Total nanos spent on seeking memtables. */
+@property (nonatomic, assign, readonly) uint64_t seekOnMemtableTime;
+
+/** @brief Number of seeks issued on memtables. */
+@property (nonatomic, assign, readonly) uint64_t seekOnMemtableCount;
+
+/** @brief Number of Next()s issued on memtables. */
+@property (nonatomic, assign, readonly) uint64_t nextOnMemtableCount;
+
+/** @brief Number of Prev()s issued on memtables. */
+@property (nonatomic, assign, readonly) uint64_t prevOnMemtableCount;
+
+/** @brief Total nanos spent on seeking child iterators. */
+@property (nonatomic, assign, readonly) uint64_t seekChildSeekTime;
+
+/** @brief Number of seeks issued in child iterators. */
+@property (nonatomic, assign, readonly) uint64_t seekChildSeekCount;
+
+/** @brief Total nanos spent on the merge min heap. */
+@property (nonatomic, assign, readonly) uint64_t seekMinHeapTime;
+
+/** @brief Total nanos spent on the merge max heap. */
+@property (nonatomic, assign, readonly) uint64_t seekMaxHeapTime;
+
+/** @brief Total nanos spent on seeking the internal entries. */
+@property (nonatomic, assign, readonly) uint64_t seekInternalSeekTime;
+
+/** @brief Total nanos spent on iterating internal entries to find the next user entry. */
+@property (nonatomic, assign, readonly) uint64_t findNextUserEntryTime;
+
+/** @brief Total nanos spent on writing to the WAL. */
+@property (nonatomic, assign, readonly) uint64_t writeWalTime;
+
+/** @brief Total nanos spent on writing to memtables. */
+@property (nonatomic, assign, readonly) uint64_t writeMemtableTime;
+
+/** @brief Total nanos spent on delaying or throttling writes. */
+@property (nonatomic, assign, readonly) uint64_t writeDelayTime;
+
+/** @brief Total nanos spent on writing a record, excluding the above four things. */
+@property (nonatomic, assign, readonly) uint64_t writePreAndPostProcessTime;
+
+/** @brief Time spent on acquiring the DB mutex. */
+@property (nonatomic, assign, readonly) uint64_t dbMutexLockNanos;
+
+/** @brief Time spent on waiting with a condition variable created with the DB mutex. */
+@property (nonatomic, assign, readonly) uint64_t dbConditionWaitNanos;
+
+/** @brief Time spent on the merge operator. */
+@property (nonatomic, assign, readonly) uint64_t mergeOperatorTimeNanos;
+
+/** @brief Time spent on reading the index block from the block cache or SST file. */
+@property (nonatomic, assign, readonly) uint64_t readIndexBlockNanos;
+
+/** @brief Time spent on reading the filter block from the block cache or SST file. */
+@property (nonatomic, assign, readonly) uint64_t readFilterBlockNanos;
+
+/** @brief Time spent on creating the data block iterator. */
+@property (nonatomic, assign, readonly) uint64_t newTableBlockIterNanos;
+
+/** @brief Time spent on creating an iterator of an SST file. */
+@property (nonatomic, assign, readonly) uint64_t newTableIteratorNanos;
+
+/** @brief Time spent on seeking a key in data or index blocks. */
+@property (nonatomic, assign, readonly) uint64_t blockSeekNanos;
+
+/** @brief Time spent on finding or creating a table reader. */
+@property (nonatomic, assign, readonly) uint64_t findTableNanos;
+
+/** @brief Total number of memtable bloom hits. */
+@property (nonatomic, assign, readonly) uint64_t bloomMemtableHitCount;
+
+/** @brief Total number of memtable bloom misses. */
+@property (nonatomic, assign, readonly) uint64_t bloomMemtableMissCount;
+
+/** @brief Total number of SST table bloom hits. */
+@property (nonatomic, assign, readonly) uint64_t bloomSstHitCount;
+
+/** @brief Total number of SST table bloom misses. */
+@property (nonatomic, assign, readonly) uint64_t bloomSstMissCount;
+
+/** @brief Time spent waiting on key locks in transaction lock manager. */
+@property (nonatomic, assign, readonly) uint64_t keyLockWaitTime;
+
+/** @brief Number of times acquiring a lock was blocked by another transaction. */
+@property (nonatomic, assign, readonly) uint64_t keyLockWaitCount;
+
+#pragma mark - IO Stats Context
+
+/** @brief Number of bytes that have been written. */
+@property (nonatomic, assign, readonly) uint64_t ioBytesWritten;
+
+/** @brief Number of bytes that have been read. */
+@property (nonatomic, assign, readonly) uint64_t ioBytesRead;
+
+/** @brief Time spent in open() and fopen(). */
+@property (nonatomic, assign, readonly) uint64_t ioOpenNanos;
+
+/** @brief Time spent in fallocate(). */
+@property (nonatomic, assign, readonly) uint64_t ioAllocateNanos;
+
+/** @brief Time spent in write() and pwrite(). */
+@property (nonatomic, assign, readonly) uint64_t ioWriteNanos;
+
+/** @brief Time spent in read() and pread(). */
+@property (nonatomic, assign, readonly) uint64_t ioReadNanos;
+
+/** @brief Time spent in sync_file_range(). */
+@property (nonatomic, assign, readonly) uint64_t ioRangeSyncNanos;
+
+/** @brief Time spent in fsync(). */
+@property (nonatomic, assign, readonly) uint64_t ioFsyncNanos;
+
+/** @brief Time spent in preparing write (fallocate etc). */
+@property (nonatomic, assign, readonly) uint64_t ioPrepareWriteNanos;
+
+/** @brief Time spent in Logger::Logv(). */
+@property (nonatomic, assign, readonly) uint64_t ioLoggerNanos;
+
+/**
+ Returns all counters keyed by their RocksDB name, e.g. `block_read_time`.
+
+ @return A dictionary of all counters.
+ */
+- (NSDictionary<NSString *, NSNumber *> *)dictionaryRepresentation;
+
+/**
+ Returns all non-zero counters keyed by their RocksDB name.
+
+ @return A dictionary of the non-zero counters.
+ */
+- (NSDictionary<NSString *, NSNumber *> *)nonZeroDictionaryRepresentation;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,186 @@
+//
+//  RocksDBPerfContext.mm
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#import "RocksDBPerfContext.h"
+
+#import <rocksdb/perf_context.h>
+#import <rocksdb/perf_level.h>
+#import <rocksdb/iostats_context.h>
+
+#define ROCKSDB_PERF_CONTEXT_COUNTERS(X) \
+	X(userKeyComparisonCount, user_key_comparison_count) \
+	X(blockCacheHitCount, block_cache_hit_count) \
+	X(blockReadCount, block_read_count) \
+	X(blockReadByte, block_read_byte) \
+	X(blockReadTime, block_read_time) \
+	X(blockChecksumTime, block_checksum_time) \
+	X(blockDecompressTime, block_decompress_time) \
+	X(getReadBytes, get_read_bytes) \
+	X(multigetReadBytes, multiget_read_bytes) \
+	X(iterReadBytes, iter_read_bytes) \
+	X(internalKeySkippedCount, internal_key_skipped_count) \
+	X(internalDeleteSkippedCount, internal_delete_skipped_count) \
+	X(internalRecentSkippedCount, internal_recent_skipped_count) \
+	X(internalMergeCount, internal_merge_count) \
+	X(getSnapshotTime, get_snapshot_time) \
+	X(getFromMemtableTime, get_from_memtable_time) \
+	X(getFromMemtableCount, get_from_memtable_count) \
+	X(getPostProcessTime, get_post_process_time) \
+	X(getFromOutputFilesTime, get_from_output_files_time) \
+	X(seekOnMemtableTime, seek_on_memtable_time) \
+	X(seekOnMemtableCount, seek_on_memtable_count) \
+	X(nextOnMemtableCount, next_on_memtable_count) \
+	X(prevOnMemtableCount, prev_on_memtable_count) \
+	X(seekChildSeekTime, seek_child_seek_time) \
+	X(seekChildSeekCount, seek_child_seek_count) \
+	X(seekMinHeapTime, seek_min_heap_time) \
+	X(seekMaxHeapTime, seek_max_heap_time) \
+	X(seekInternalSeekTime, seek_internal_seek_time) \
+	X(findNextUserEntryTime, find_next_user_entry_time) \
+	X(writeWalTime, write_wal_time) \
+	X(writeMemtableTime, write_memtable_time) \
+	X(writeDelayTime, write_delay_time) \
+	X(writePreAndPostProcessTime, write_pre_and_post_process_time) \
+	X(dbMutexLockNanos, db_mutex_lock_nanos) \
+	X(dbConditionWaitNanos, db_condition_wait_nanos) \
+	X(mergeOperatorTimeNanos, merge_operator_time_nanos) \
+	X(readIndexBlockNanos, read_index_block_nanos) \
+	X(readFilterBlockNanos, read_filter_block_nanos) \
+	X(newTableBlockIterNanos, new_table_block_iter_nanos) \
+	X(newTableIteratorNanos, new_table_iterator_nanos) \
+	X(blockSeekNanos, block_seek_nanos) \
+	X(findTableNanos, find_table_nanos) \
+	X(bloomMemtableHitCount, bloom_memtable_hit_count) \
+	X(bloomMemtableMissCount, bloom_memtable_miss_count) \
+	X(bloomSstHitCount, bloom_sst_hit_count) \
+	X(bloomSstMissCount, bloom_sst_miss_count) \
+	X(keyLockWaitTime, key_lock_wait_time) \
+	X(keyLockWaitCount, key_lock_wait_count)
+
+#define ROCKSDB_IOSTATS_CONTEXT_COUNTERS(X) \
+	X(ioBytesWritten, bytes_written) \
+	X(ioBytesRead, bytes_read) \
+	X(ioOpenNanos, open_nanos) \
+	X(ioAllocateNanos, allocate_nanos) \
+	X(ioWriteNanos, write_nanos) \
+	X(ioReadNanos, read_nanos) \
+	X(ioRangeSyncNanos, range_sync_nanos) \
+	X(ioFsyncNanos, fsync_nanos) \
+	X(ioPrepareWriteNanos, prepare_write_nanos) \
+	X(ioLoggerNanos, logger_nanos)
+
+#define ROCKSDB_COUNTER_IVAR(property, field) uint64_t _##property;
+
+@interface RocksDBPerfContext ()
+{
+	ROCKSDB_PERF_CONTEXT_COUNTERS(ROCKSDB_COUNTER_IVAR)
+	ROCKSDB_IOSTATS_CONTEXT_COUNTERS(ROCKSDB_COUNTER_IVAR)
+}
+@end
+
+@implementation RocksDBPerfContext
+
+#pragma mark - Thread Local Context
+
++ (RocksDBPerfLevel)perfLevel
+{
+	return (RocksDBPerfLevel)rocksdb::GetPerfLevel();
+}
+
++ (void)setPerfLevel:(RocksDBPerfLevel)level
+{
+	rocksdb::SetPerfLevel((rocksdb::PerfLevel)level);
+}
+
++ (void)reset
+{
+	rocksdb::get_perf_context()->Reset();
+	rocksdb::get_iostats_context()->Reset();
+}
+
++ (RocksDBPerfContext *)currentContext
+{
+	return [[self alloc] initWithPerfContext:*rocksdb::get_perf_context()
+							  iostatsContext:*rocksdb::get_iostats_context()];
+}
+
++ (RocksDBPerfContext *)contextByMeasuringBlock:(void (^)(void))block withPerfLevel:(RocksDBPerfLevel)level
+{
+	rocksdb::PerfLevel previousLevel = rocksdb::GetPerfLevel();
+
+	rocksdb::SetPerfLevel((rocksdb::PerfLevel)level);
+	[self reset];
+
+	block();
+
+	RocksDBPerfContext *context = [self currentContext];
+	rocksdb::SetPerfLevel(previousLevel);
+	return context;
+}
+
+#pragma mark - Lifecycle
+
+- (instancetype)initWithPerfContext:(const rocksdb::PerfContext &)perfContext
+					 iostatsContext:(const rocksdb::IOStatsContext &)iostatsContext
+{
+	self = [super init];
+	if (self) {
+#define ROCKSDB_PERF_CONTEXT_COPY(property, field) _##property = perfContext.field;
+#define ROCKSDB_IOSTATS_CONTEXT_COPY(property, field) _##property = iostatsContext.field;
+
+		ROCKSDB_PERF_CONTEXT_COUNTERS(ROCKSDB_PERF_CONTEXT_COPY)
+		ROCKSDB_IOSTATS_CONTEXT_COUNTERS(ROCKSDB_IOSTATS_CONTEXT_COPY)
+
+#undef ROCKSDB_PERF_CONTEXT_COPY
+#undef ROCKSDB_IOSTATS_CONTEXT_COPY
+	}
+	return self;
+}
+
+#pragma mark - Accessors
+
+#define ROCKSDB_COUNTER_ACCESSOR(property, field) - (uint64_t)property { return _##property; }
+
+ROCKSDB_PERF_CONTEXT_COUNTERS(ROCKSDB_COUNTER_ACCESSOR)
+ROCKSDB_IOSTATS_CONTEXT_COUNTERS(ROCKSDB_COUNTER_ACCESSOR)
+
+#pragma mark - Dictionary
+
+- (NSDictionary<NSString *, NSNumber *> *)dictionaryRepresentationIncludingZero:(BOOL)includeZero
+{
+	NSMutableDictionary *dictionary = [NSMutableDictionary dictionary];
+
+#define ROCKSDB_COUNTER_ENTRY(property, field) \
+	if (includeZero || _##property > 0) dictionary[@#field] = @(_##property);
+
+	ROCKSDB_PERF_CONTEXT_COUNTERS(ROCKSDB_COUNTER_ENTRY)
+	ROCKSDB_IOSTATS_CONTEXT_COUNTERS(ROCKSDB_COUNTER_ENTRY)
+
+#undef ROCKSDB_COUNTER_ENTRY
+
+	return dictionary;
+}
+
+- (NSDictionary<NSString *, NSNumber *> *)dictionaryRepresentation
+{
+	return [self dictionaryRepresentationIncludingZero:YES];
+}
+
+- (NSDictionary<NSString *, NSNumber *> *)nonZeroDictionaryRepresentation
+{
+	return [self dictionaryRepresentationIncludingZero:NO];
+}
+
+#pragma mark - Description
+
+- (NSString *)description
+{
+	return [NSString stringWithFormat:@"<RocksDBPerfContext %@>", [self nonZeroDictionaryRepresentation]];
+}
+
+@end
@@ -0,0 +1,90 @@
+//
+//  RocksDBPersistentCache.h
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** @brief The policy deciding which blocks are written to the persistent cache. */
+typedef NS_ENUM(NSUInteger, RocksDBPersistentCacheAdmissionPolicy)
+{
+	/** @brief Every block read from a table file is written to the persistent cache. */
+	RocksDBPersistentCacheAdmissionPolicyAll = 0,
+
+	/** @brief A block is written to the persistent cache the second time it is read from a table file,
+	 thus blocks read only once, e.g. by scans, don't evict the frequently read ones. */
+	RocksDBPersistentCacheAdmissionPolicySecondAccess
+};
+
+/**
+ A `RocksDBPersistentCache` is a secondary cache tier on a local, fast storage device, e.g. an SSD in front of
+ network-attached volumes.
+
+ @discussion When set in the `RocksDBBlockBasedTableOptions`, blocks missing from the block cache are looked up
+ in the persistent cache before they are read from the table files, and blocks read from the table files are
+ written to the persistent cache according to its admission policy. Writes are pipelined on a background
+ thread and don't block the reads.
+
+ @see RocksDBBlockBasedTableOptions
+
+ @warning Not available in RocksDB Lite.
+ */
+@interface RocksDBPersistentCache : NSObject
+
+/**
+ Creates a new persistent cache in the given directory, which admits all blocks.
+
+ @param path The directory of the cache. It is created if missing and any previous content is discarded.
+ @param size The maximum size of the cache on disk in bytes. Must be at least 100MB, the size of one cache file.
+ @param error If an error occurs, upon return contains an `NSError` object that describes the problem.
+ @return A new persistent cache, or nil if the cache couldn't be created.
+ */
++ (nullable instancetype)persistentCacheAtPath:(NSString *)path
+										  size:(uint64_t)size
+										 error:(NSError * __autoreleasing *)error;
+
+/**
+ Creates a new persistent cache in the given directory.
+
+ @param path The directory of the cache. It is created if missing and any previous content is discarded.
+ @param size The maximum size of the cache on disk in bytes. Must be at least 100MB, the size of one cache file.
+ @param optimizedForNVM If true, the cache files are written with direct I/O and higher parallelism, which suits
+ NVMe devices better than the default settings, which are optimized for SSDs.
+ @param admissionPolicy The policy deciding which blocks are written to the cache.
+ @param error If an error occurs, upon return contains an `NSError` object that describes the problem.
+ @return A new persistent cache, or nil if the cache couldn't be created.
+ */
++ (nullable instancetype)persistentCacheAtPath:(NSString *)path
+										  size:(uint64_t)size
+							   optimizedForNVM:(BOOL)optimizedForNVM
+							   admissionPolicy:(RocksDBPersistentCacheAdmissionPolicy)admissionPolicy
+										 error:(NSError * __autoreleasing *)error;
+
+/** @brief The directory of the cache. */
+@property (nonatomic, copy, readonly) NSString *path;
+
+/** @brief The maximum size of the cache on disk in bytes. */
+@property (nonatomic, assign, readonly) uint64_t size;
+
+/** @brief The policy deciding which blocks are written to the cache. */
+@property (nonatomic, assign, readonly) RocksDBPersistentCacheAdmissionPolicy admissionPolicy;
+
+/**
+ Returns the cache's statistics, e.g. its hit and miss counts and latencies.
+
+ @discussion The keys are defined by RocksDB's block cache tier, e.g. `persistentcache.blockcachetier.cache_hits`.
+ With the `RocksDBPersistentCacheAdmissionPolicySecondAccess` policy the counts of admitted and rejected blocks
+ are included as `objectiverocks.admission.admitted` and `objectiverocks.admission.rejected`.
+
+ @return A dictionary mapping each statistic's name to its value.
+ */
+- (NSDictionary<NSString *, NSNumber *> *)statistics;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,125 @@
+//
+//  RocksDBPersistentCache.mm
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#import "RocksDBPersistentCache.h"
+#import "RocksDBNativePersistentCache.h"
+#import "RocksDBError.h"
+
+#import <rocksdb/env.h>
+#import <rocksdb/persistent_cache.h>
+
+// Number of block keys remembered by the second access admission policy
+static const size_t kSecondAccessCapacity = 1 << 20;
+
+// Defaults of the PersistentCacheConfig created by NewPersistentCache, which asserts on invalid
+// settings before returning an error, thus they have to be validated up front
+static const uint64_t kCacheFileSize = 100ULL * 1024 * 1024;
+static const uint64_t kWriteBufferSize = 1ULL * 1024 * 1024;
+static const uint64_t kWriterQueueDepth = 1;
+static const uint64_t kWriteBufferCount = (uint64_t)((kWriterQueueDepth + 1.2) * kCacheFileSize / kWriteBufferSize);
+
+static_assert(kWriteBufferSize < kCacheFileSize && kWriteBufferSize * kWriteBufferCount >= 2 * kCacheFileSize,
+			  "The write buffers must hold two cache files");
+
+@interface RocksDBPersistentCache ()
+{
+	std::shared_ptr<rocksdb::PersistentCache> _persistentCache;
+}
+@property (nonatomic, assign) std::shared_ptr<rocksdb::PersistentCache> persistentCache;
+@property (nonatomic, copy) NSString *path;
+@property (nonatomic, assign) uint64_t size;
+@property (nonatomic, assign) RocksDBPersistentCacheAdmissionPolicy admissionPolicy;
+@end
+
+@implementation RocksDBPersistentCache
+@synthesize persistentCache = _persistentCache;
+@synthesize path = _path;
+@synthesize size = _size;
+@synthesize admissionPolicy = _admissionPolicy;
+
+#pragma mark - Lifecycle
+
++ (instancetype)persistentCacheAtPath:(NSString *)path size:(uint64_t)size error:(NSError * __autoreleasing *)error
+{
+	return [self persistentCacheAtPath:path
+								  size:size
+					   optimizedForNVM:NO
+					   admissionPolicy:RocksDBPersistentCacheAdmissionPolicyAll
+								 error:error];
+}
+
++ (instancetype)persistentCacheAtPath:(NSString *)path
+								 size:(uint64_t)size
+					  optimizedForNVM:(BOOL)optimizedForNVM
+					  admissionPolicy:(RocksDBPersistentCacheAdmissionPolicy)admissionPolicy
+								error:(NSError * __autoreleasing *)error
+{
+	rocksdb::Status status;
+	if (path.length == 0) {
+		status = rocksdb::Status::InvalidArgument("The persistent cache path must not be empty");
+	} else if (size < kCacheFileSize) {
+		status = rocksdb::Status::InvalidArgument("The persistent cache size must be at least the size of one cache file");
+	}
+	if (!status.ok()) {
+		NSError *temp = [RocksDBError errorWithRocksStatus:status];
+		if (error && *error == nil) {
+			*error = temp;
+		}
+		return nil;
+	}
+
+	std::shared_ptr<rocksdb::PersistentCache> cache;
+	status = rocksdb::NewPersistentCache(rocksdb::Env::Default(),
+										 path.fileSystemRepresentation,
+										 size,
+										 nullptr,
+										 optimizedForNVM,
+										 &cache);
+	if (!status.ok()) {
+		NSError *temp = [RocksDBError errorWithRocksStatus:status];
+		if (error && *error == nil) {
+			*error = temp;
+		}
+		return nil;
+	}
+
+	if (admissionPolicy == RocksDBPersistentCacheAdmissionPolicySecondAccess) {
+		cache = RocksDBSecondAccessPersistentCache(cache, kSecondAccessCapacity);
+	}
+
+	RocksDBPersistentCache *persistentCache = [RocksDBPersistentCache new];
+	persistentCache.persistentCache = cache;
+	persistentCache.path = path;
+	persistentCache.size = size;
+	persistentCache.admissionPolicy = admissionPolicy;
+	return persistentCache;
+}
+
+- (void)dealloc
+{
+	@synchronized(self) {
+		if (_persistentCache != nullptr) {
+			_persistentCache.reset();
+		}
+	}
+}
+
+#pragma mark - Statistics
+
+- (NSDictionary<NSString *, NSNumber *> *)statistics
+{
+	NSMutableDictionary *statistics = [NSMutableDictionary dictionary];
+	for (const auto &tier : _persistentCache->Stats()) {
+		for (const auto &stat : tier) {
+			statistics[@(stat.first.c_str())] = @(stat.second);
+		}
+	}
+	return statistics;
+}
+
+@end
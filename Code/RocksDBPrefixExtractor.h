@@ -16,9 +16,26 @@ NS_ASSUME_NONNULL_BEGIN
 typedef NS_ENUM(NSUInteger, RocksDBPrefixType)
 {
 	/** @brief Extract a fixed-length prefix for each key. */
-	RocksDBPrefixFixedLength
+	RocksDBPrefixFixedLength,
+
+	/** @brief Extract a prefix of at most the given length, shorter keys are their own prefix. */
+	RocksDBPrefixCappedLength
 };
 
+/**
+ A plain C transform function, which extracts the prefix of a key.
+
+ @return The length of the key's prefix, which must not exceed the key's length.
+ */
+typedef size_t (* RocksDBPrefixTransformFunction)(void * _Nullable context, const char *key, size_t length);
+
+/**
+ A plain C predicate function, which checks a key or prefix.
+
+ @return `true` if the key is a prefix candidate, or respectively the prefix is valid, `false` otherwise.
+ */
+typedef bool (* RocksDBPrefixPredicateFunction)(void * _Nullable context, const char *data, size_t length);
+
 /**
  `RocksDBIterator` supports iterating inside a key-prefix by providing a `RocksDBPrefixExtractor`.
 
@@ -36,6 +53,20 @@ typedef NS_ENUM(NSUInteger, RocksDBPrefixType)
  */
 + (instancetype)prefixExtractorWithType:(RocksDBPrefixType)type length:(size_t)length;
 
+/**
+ Intializes a new instance of a native prefix extractor, which extracts the prefix of each key up
+ to and including the `count`-th occurrence of the given delimiter byte.
+
+ @discussion This extractor suits variable-length hierarchical keys, e.g. a delimiter `:` with a count
+ of 2 extracts the prefix `tenant:entity:` of the key `tenant:entity:id`. Keys containing fewer
+ delimiters have no prefix and are not added to the prefix bloom filters.
+
+ @param delimiter The delimiter byte separating the key's components.
+ @param count The number of components in the prefix, must be greater than zero.
+ @return A newly-initialized instance of a prefix extractor.
+ */
++ (instancetype)prefixExtractorWithDelimiter:(uint8_t)delimiter count:(NSUInteger)count;
+
 /**
  Intializes a new instance of the prefix extarctor with the given transformation functions.
 
@@ -52,6 +83,29 @@ typedef NS_ENUM(NSUInteger, RocksDBPrefixType)
 		prefixCandidateBlock:(BOOL (^)(NSData *key))prefixCandidateBlock
 			validPrefixBlock:(BOOL (^)(NSData *prefix))validPrefixBlock;
 
+/**
+ Intializes a new instance of the prefix extarctor with the given plain C functions.
+
+ @discussion The functions are called directly from RocksDB, without any Objective-C message send,
+ `NSData` boxing or autorelease traffic. Instead of returning a new object, the transform function
+ returns the length of the prefix within the key. The functions may be called concurrently from
+ multiple threads. The context is neither retained nor freed and must outlive the database.
+
+ @param name The name of the prefix extractor.
+ @param context An arbitrary pointer passed to the functions.
+ @param transformFunction A function returning the length of the prefix of each key.
+ @param prefixCandidateFunction A function that is applied to each key before the transformation
+ in order to filter out keys that are not viable candidates for the custom prefix format.
+ @param validPrefixFunction A function that is applied to each prefix after the transformation in
+ order to perform extra checks to verify that the extracted prefix is valid.
+ @return A newly-initialized instance of a prefix extractor.
+ */
+- (instancetype)initWithName:(NSString *)name
+					 context:(nullable void *)context
+		   transformFunction:(RocksDBPrefixTransformFunction)transformFunction
+	 prefixCandidateFunction:(RocksDBPrefixPredicateFunction)prefixCandidateFunction
+		 validPrefixFunction:(RocksDBPrefixPredicateFunction)validPrefixFunction;
+
 @end
 
 NS_ASSUME_NONNULL_END
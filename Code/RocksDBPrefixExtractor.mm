@@ -9,13 +9,25 @@
 #import "RocksDBPrefixExtractor.h"
 #import "RocksDBSlice.h"
 #import "RocksDBCallbackSliceTransform.h"
+#import "RocksDBNativeSliceTransform.h"
 
 #import <rocksdb/slice_transform.h>
 #import <rocksdb/slice.h>
 
+#include <algorithm>
+
+struct RocksDBPrefixExtractorFunctions
+{
+	void *context;
+	RocksDBPrefixTransformFunction transform;
+	RocksDBPrefixPredicateFunction prefixCandidate;
+	RocksDBPrefixPredicateFunction validPrefix;
+};
+
 @interface RocksDBPrefixExtractor ()
 {
 	NSString *_name;
+	RocksDBPrefixExtractorFunctions _functions;
 	const rocksdb::SliceTransform *_sliceTransform;
 
 	NSData * (^ _transformBlock)(NSData *key);
@@ -37,9 +49,17 @@
 	switch (type) {
 		case RocksDBPrefixFixedLength:
 			return [[self alloc] initWithNativeSliceTransform:rocksdb::NewFixedPrefixTransform(length)];
+		case RocksDBPrefixCappedLength:
+			return [[self alloc] initWithNativeSliceTransform:rocksdb::NewCappedPrefixTransform(length)];
 	}
 }
 
++ (instancetype)prefixExtractorWithDelimiter:(uint8_t)delimiter count:(NSUInteger)count
+{
+	NSParameterAssert(count > 0);
+	return [[self alloc] initWithNativeSliceTransform:RocksDBDelimiterPrefixTransform(delimiter, count)];
+}
+
 - (instancetype)initWithNativeSliceTransform:(const rocksdb::SliceTransform *)sliceTransform
 {
 	self = [super init];
@@ -67,6 +87,27 @@
 	return self;
 }
 
+- (instancetype)initWithName:(NSString *)name
+					 context:(void *)context
+		   transformFunction:(RocksDBPrefixTransformFunction)transformFunction
+	 prefixCandidateFunction:(RocksDBPrefixPredicateFunction)prefixCandidateFunction
+		 validPrefixFunction:(RocksDBPrefixPredicateFunction)validPrefixFunction
+{
+	self = [super init];
+	if (self) {
+		_name = [name copy];
+		_functions.context = context;
+		_functions.transform = transformFunction;
+		_functions.prefixCandidate = prefixCandidateFunction;
+		_functions.validPrefix = validPrefixFunction;
+		_sliceTransform = RocksDBCallbackSliceTransform(&_functions, _name.UTF8String,
+														&trampolineTransformFunction,
+														&trampolineInDomainFunction,
+														&trampolineInRangeFunction);
+	}
+	return self;
+}
+
 - (void)dealloc
 {
 	@synchronized(self) {
@@ -114,4 +155,25 @@ bool trampolineInRange(void* instance, const rocksdb::Slice& dst)
 	return _validPrefixBlock(prefix);
 }
 
+#pragma mark - Function Callbacks
+
+rocksdb::Slice trampolineTransformFunction(void* functions, const rocksdb::Slice& src)
+{
+	RocksDBPrefixExtractorFunctions *extractor = static_cast<RocksDBPrefixExtractorFunctions *>(functions);
+	size_t length = extractor->transform(extractor->context, src.data(), src.size());
+	return rocksdb::Slice(src.data(), std::min(length, src.size()));
+}
+
+bool trampolineInDomainFunction(void* functions, const rocksdb::Slice& src)
+{
+	RocksDBPrefixExtractorFunctions *extractor = static_cast<RocksDBPrefixExtractorFunctions *>(functions);
+	return extractor->prefixCandidate(extractor->context, src.data(), src.size());
+}
+
+bool trampolineInRangeFunction(void* functions, const rocksdb::Slice& dst)
+{
+	RocksDBPrefixExtractorFunctions *extractor = static_cast<RocksDBPrefixExtractorFunctions *>(functions);
+	return extractor->validPrefix(extractor->context, dst.data(), dst.size());
+}
+
 @end
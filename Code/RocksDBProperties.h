@@ -15,6 +15,7 @@ typedef NS_ENUM(NSUInteger, RocksDBProperty)
 	RocksDBPropertySsTables,
 	RocksDBPropertyCFStats,
 	RocksDBPropertyDBStats,
+	RocksDBPropertyAggregatedTableProperties,
 };
 
 typedef NS_ENUM(NSUInteger, RocksDBIntProperty)
@@ -34,7 +35,22 @@ typedef NS_ENUM(NSUInteger, RocksDBIntProperty)
 	RocksDBIntPropertyIsFileDeletionEnabled,
 	RocksDBIntPropertyNumSnapshots,
 	RocksDBIntPropertyOldestSnapshotTime,
-	RocksDBIntPropertyNumLiveVersions
+	RocksDBIntPropertyNumLiveVersions,
+	RocksDBIntPropertyEstimatedLiveDataSize,
+	RocksDBIntPropertyBlockCacheCapacity,
+	RocksDBIntPropertyBlockCacheUsage,
+	RocksDBIntPropertyBlockCachePinnedUsage,
+	RocksDBIntPropertyEstimatedPendingCompactionBytes,
+	RocksDBIntPropertyNumRunningCompactions,
+	RocksDBIntPropertyNumRunningFlushes,
+	RocksDBIntPropertyActualDelayedWriteRate,
+	RocksDBIntPropertyIsWriteStopped,
+	RocksDBIntPropertyTotalSstFilesSize,
+	RocksDBIntPropertyLiveSstFilesSize,
+	RocksDBIntPropertySizeAllMemTables,
+	RocksDBIntPropertyEstimatedOldestKeyTime,
+	RocksDBIntPropertyBaseLevel,
+	RocksDBIntPropertyMinLogNumberToKeep
 };
 
 extern NSString * ResolveProperty(RocksDBProperty property);
@@ -22,6 +22,8 @@ NSString * ResolveProperty(RocksDBProperty property) {
 			return @(rocksdb::DB::Properties::kCFStats.c_str());
 		case RocksDBPropertyDBStats:
 			return @(rocksdb::DB::Properties::kDBStats.c_str());
+		case RocksDBPropertyAggregatedTableProperties:
+			return @(rocksdb::DB::Properties::kAggregatedTableProperties.c_str());
 		default:
 			return @"";
 	}
@@ -61,6 +63,36 @@ NSString * ResolveIntProperty(RocksDBIntProperty property) {
 			return @(rocksdb::DB::Properties::kOldestSnapshotTime.c_str());
 		case RocksDBIntPropertyNumLiveVersions:
 			return @(rocksdb::DB::Properties::kNumLiveVersions.c_str());
+		case RocksDBIntPropertyEstimatedLiveDataSize:
+			return @(rocksdb::DB::Properties::kEstimateLiveDataSize.c_str());
+		case RocksDBIntPropertyBlockCacheCapacity:
+			return @(rocksdb::DB::Properties::kBlockCacheCapacity.c_str());
+		case RocksDBIntPropertyBlockCacheUsage:
+			return @(rocksdb::DB::Properties::kBlockCacheUsage.c_str());
+		case RocksDBIntPropertyBlockCachePinnedUsage:
+			return @(rocksdb::DB::Properties::kBlockCachePinnedUsage.c_str());
+		case RocksDBIntPropertyEstimatedPendingCompactionBytes:
+			return @(rocksdb::DB::Properties::kEstimatePendingCompactionBytes.c_str());
+		case RocksDBIntPropertyNumRunningCompactions:
+			return @(rocksdb::DB::Properties::kNumRunningCompactions.c_str());
+		case RocksDBIntPropertyNumRunningFlushes:
+			return @(rocksdb::DB::Properties::kNumRunningFlushes.c_str());
+		case RocksDBIntPropertyActualDelayedWriteRate:
+			return @(rocksdb::DB::Properties::kActualDelayedWriteRate.c_str());
+		case RocksDBIntPropertyIsWriteStopped:
+			return @(rocksdb::DB::Properties::kIsWriteStopped.c_str());
+		case RocksDBIntPropertyTotalSstFilesSize:
+			return @(rocksdb::DB::Properties::kTotalSstFilesSize.c_str());
+		case RocksDBIntPropertyLiveSstFilesSize:
+			return @(rocksdb::DB::Properties::kLiveSstFilesSize.c_str());
+		case RocksDBIntPropertySizeAllMemTables:
+			return @(rocksdb::DB::Properties::kSizeAllMemTables.c_str());
+		case RocksDBIntPropertyEstimatedOldestKeyTime:
+			return @(rocksdb::DB::Properties::kEstimateOldestKeyTime.c_str());
+		case RocksDBIntPropertyBaseLevel:
+			return @(rocksdb::DB::Properties::kBaseLevel.c_str());
+		case RocksDBIntPropertyMinLogNumberToKeep:
+			return @(rocksdb::DB::Properties::kMinLogNumberToKeep.c_str());
 		default:
 			return @"";
 	}
@@ -11,6 +11,8 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
+@class RocksDBStatisticsSnapshot;
+
 /** @brief An enum for the Ticker Types. */
 typedef NS_ENUM(uint32_t, RocksDBTicker)
 {
@@ -571,6 +573,25 @@ typedef NS_ENUM(uint32_t, RocksDBHistogram)
 	RocksDBHistogramFlushTime
 };
 
+/** @brief An enum for the levels of detail at which statistics are collected. */
+typedef NS_ENUM(uint8_t, RocksDBStatsLevel)
+{
+	/** @brief Collect tickers only, no histograms and no timers. */
+	RocksDBStatsLevelExceptHistogramOrTimers = 0,
+
+	/** @brief Collect tickers and histograms, but skip all timers. */
+	RocksDBStatsLevelExceptTimers,
+
+	/** @brief Collect everything except the timers within mutexes and compression timers. This is the default. */
+	RocksDBStatsLevelExceptDetailedTimers,
+
+	/** @brief Collect everything except the time spent waiting for mutexes. */
+	RocksDBStatsLevelExceptTimeForMutex,
+
+	/** @brief Collect everything, which may incur a noticeable overhead. */
+	RocksDBStatsLevelAll
+};
+
 /**
  The `RocksDBStatistics`, when set in the `RocksDBOptions`, is used to collect usage statistics.
 
@@ -578,6 +599,16 @@ typedef NS_ENUM(uint32_t, RocksDBHistogram)
  */
 @interface RocksDBStatistics : NSObject
 
+/**
+ @brief The level of detail at which statistics are collected. Defaults to `RocksDBStatsLevelExceptDetailedTimers`.
+
+ @discussion The level can be changed at any time, even while the database is in use, e.g. to keep the
+ cheap tickers enabled permanently and turn on the timer-based histograms only while investigating.
+ The native level is a plain field, which isn't synchronized with the database's threads, thus
+ operations running concurrently with the change may still be recorded at the previous level.
+ */
+@property (nonatomic, assign) RocksDBStatsLevel statsLevel;
+
 /**
  Returns the value for the given ticker.
 
@@ -596,6 +627,19 @@ typedef NS_ENUM(uint32_t, RocksDBHistogram)
  */
 - (RocksDBStatisticsHistogram *)histogramDataForType:(RocksDBHistogram)type;
 
+/**
+ Captures the current values of all tickers and histograms at once.
+
+ @discussion Prefer this over many individual `countForTicker:` and `histogramDataForType:` calls
+ when exporting metrics periodically. Use `deltaFromSnapshot:` to compute the values recorded
+ between two snapshots.
+
+ @return An immutable snapshot of all tickers and histograms.
+
+ @see RocksDBStatisticsSnapshot
+ */
+- (RocksDBStatisticsSnapshot *)snapshot;
+
 /** @brief String representation of the statistic object. */
 - (NSString *)description;
 
@@ -7,6 +7,7 @@
 //
 
 #import "RocksDBStatistics.h"
+#import "RocksDBStatisticsSnapshot.h"
 
 #import <rocksdb/statistics.h>
 
@@ -19,13 +20,14 @@
 @property (nonatomic, assign) std::shared_ptr<rocksdb::Statistics> statistics;
 @end
 
+@interface RocksDBStatisticsSnapshot ()
+- (instancetype)initWithNativeStatistics:(const std::shared_ptr<rocksdb::Statistics> &)statistics;
+@end
+
 @interface RocksDBStatisticsHistogram ()
-@property (nonatomic, copy) NSString *ticker;
-@property (nonatomic, assign) double median;
-@property (nonatomic, assign) double percentile95;
-@property (nonatomic, assign) double percentile99;
-@property (nonatomic, assign) double average;
-@property (nonatomic, assign) double standardDeviation;
+- (instancetype)initWithType:(uint32_t)type
+						data:(const rocksdb::HistogramData &)data
+			 histogramString:(const std::string &)histogramString;
 @end
 
 #pragma mark - Impl
@@ -55,6 +57,16 @@
 
 #pragma mark - Accessor
 
+- (RocksDBStatsLevel)statsLevel
+{
+	return (RocksDBStatsLevel)_statistics->stats_level_;
+}
+
+- (void)setStatsLevel:(RocksDBStatsLevel)statsLevel
+{
+	_statistics->stats_level_ = (rocksdb::StatsLevel)statsLevel;
+}
+
 - (uint64_t)countForTicker:(RocksDBTicker)ticker
 {
 	return _statistics->getTickerCount(ticker);
@@ -62,23 +74,19 @@
 
 - (RocksDBStatisticsHistogram *)histogramDataForType:(RocksDBHistogram)ticker
 {
-	rocksdb::HistogramData *data = new rocksdb::HistogramData;
-	_statistics->histogramData(ticker, data);
-
-	RocksDBStatisticsHistogram *histogram = [RocksDBStatisticsHistogram new];
+	rocksdb::HistogramData data;
+	_statistics->histogramData(ticker, &data);
 
-	std::string tickerName = rocksdb::HistogramsNameMap[ticker].second;
-
-	histogram.ticker = [NSString stringWithCString:tickerName.c_str() encoding:NSUTF8StringEncoding];
-	histogram.median = data->median;
-	histogram.percentile95 = data->percentile95;
-	histogram.percentile95 = data->percentile99;
-	histogram.average = data->average;
-	histogram.standardDeviation = data->standard_deviation;
+	return [[RocksDBStatisticsHistogram alloc] initWithType:ticker
+													   data:data
+											histogramString:_statistics->getHistogramString(ticker)];
+}
 
-	delete data;
+#pragma mark - Snapshot
 
-	return histogram;
+- (RocksDBStatisticsSnapshot *)snapshot
+{
+	return [[RocksDBStatisticsSnapshot alloc] initWithNativeStatistics:_statistics];
 }
 
 #pragma mark - Description
@@ -31,6 +31,56 @@ NS_ASSUME_NONNULL_BEGIN
 /** @brief The standard deviation value. */
 @property (nonatomic, assign, readonly) double standardDeviation;
 
+/** @brief The percentile99.9 value, computed from the buckets. */
+@property (nonatomic, assign, readonly) double percentile999;
+
+/** @brief The maximum recorded value. */
+@property (nonatomic, assign, readonly) double max;
+
+/** @brief The minimum recorded value. */
+@property (nonatomic, assign, readonly) double min;
+
+/** @brief The number of recorded values. */
+@property (nonatomic, assign, readonly) uint64_t count;
+
+/** @brief The sum of all recorded values. */
+@property (nonatomic, assign, readonly) uint64_t sum;
+
+/**
+ @brief The exclusive lower bounds of the non-empty buckets, in ascending order.
+
+ @discussion The first bucket of RocksDB's bucket layout is the only one whose lower bound, 0,
+ is inclusive. Empty buckets are omitted.
+ */
+@property (nonatomic, copy, readonly) NSArray<NSNumber *> *bucketLowerBounds;
+
+/** @brief The inclusive upper bounds of the non-empty buckets, in ascending order. */
+@property (nonatomic, copy, readonly) NSArray<NSNumber *> *bucketUpperBounds;
+
+/** @brief The number of values recorded in each of the non-empty buckets. */
+@property (nonatomic, copy, readonly) NSArray<NSNumber *> *bucketCounts;
+
+/**
+ Computes the given percentile from the buckets, interpolating linearly within a bucket
+ the same way RocksDB does.
+
+ @param percentile The percentile to compute, between 0 and 100.
+ @return The value at the given percentile, or 0 if the histogram has no buckets.
+ */
+- (double)valueAtPercentile:(double)percentile;
+
+/**
+ Returns a new histogram combining the values recorded in the receiver and the given histogram,
+ e.g. to aggregate the same histogram type across several database instances.
+
+ @discussion Counts, sums and buckets are added, while the minimum, maximum, average and standard
+ deviation are combined exactly. The percentiles are recomputed from the merged buckets.
+
+ @param histogram The histogram to merge with the receiver.
+ @return A new histogram holding the merged values.
+ */
+- (RocksDBStatisticsHistogram *)histogramByMergingHistogram:(RocksDBStatisticsHistogram *)histogram;
+
 @end
 
 NS_ASSUME_NONNULL_END
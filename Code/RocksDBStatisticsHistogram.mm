@@ -8,6 +8,16 @@
 
 #import "RocksDBStatisticsHistogram.h"
 
+#import <rocksdb/statistics.h>
+
+#include <cinttypes>
+#include <cmath>
+#include <map>
+#include <sstream>
+
+/** Non-empty buckets keyed by their inclusive upper bound, holding their exclusive lower bound and count. */
+typedef std::map<uint64_t, std::pair<uint64_t, uint64_t>> RocksDBHistogramBuckets;
+
 @interface RocksDBStatisticsHistogram ()
 @property (nonatomic, copy) NSString *ticker;
 @property (nonatomic, assign) double median;
@@ -15,18 +25,198 @@
 @property (nonatomic, assign) double percentile99;
 @property (nonatomic, assign) double average;
 @property (nonatomic, assign) double standardDeviation;
+@property (nonatomic, assign) double percentile999;
+@property (nonatomic, assign) double max;
+@property (nonatomic, assign) double min;
+@property (nonatomic, assign) uint64_t count;
+@property (nonatomic, assign) uint64_t sum;
+@property (nonatomic, copy) NSArray<NSNumber *> *bucketLowerBounds;
+@property (nonatomic, copy) NSArray<NSNumber *> *bucketUpperBounds;
+@property (nonatomic, copy) NSArray<NSNumber *> *bucketCounts;
 @end
 
 @implementation RocksDBStatisticsHistogram
 @synthesize ticker, median, percentile95, percentile99, average, standardDeviation;
+@synthesize percentile999, max, min, count, sum, bucketLowerBounds, bucketUpperBounds, bucketCounts;
+
+#pragma mark - Lifecycle
+
+- (instancetype)init
+{
+	self = [super init];
+	if (self) {
+		self.bucketLowerBounds = @[];
+		self.bucketUpperBounds = @[];
+		self.bucketCounts = @[];
+	}
+	return self;
+}
+
+- (instancetype)initWithType:(uint32_t)type
+						data:(const rocksdb::HistogramData &)data
+			 histogramString:(const std::string &)histogramString
+{
+	return [self initWithType:type data:data buckets:[RocksDBStatisticsHistogram bucketsFromHistogramString:histogramString]];
+}
+
+- (instancetype)initWithType:(uint32_t)type
+						data:(const rocksdb::HistogramData &)data
+					 buckets:(const RocksDBHistogramBuckets &)buckets
+{
+	self = [self init];
+	if (self) {
+		std::string tickerName = rocksdb::HistogramsNameMap[type].second;
+
+		self.ticker = [NSString stringWithCString:tickerName.c_str() encoding:NSUTF8StringEncoding];
+		self.median = data.median;
+		self.percentile95 = data.percentile95;
+		self.percentile99 = data.percentile99;
+		self.average = data.average;
+		self.standardDeviation = data.standard_deviation;
+		self.max = data.max;
+		self.min = data.min;
+		self.count = data.count;
+		self.sum = data.sum;
+
+		[self setBuckets:buckets];
+		self.percentile999 = [self valueAtPercentile:99.9];
+	}
+	return self;
+}
+
+/**
+ RocksDB doesn't expose the raw buckets of its histograms, other than through their string
+ representation, which lists each non-empty bucket on its own line in the form:
+ `[       0,       1 ]      123  12.300%  12.300% ##`
+ */
++ (RocksDBHistogramBuckets)bucketsFromHistogramString:(const std::string &)histogramString
+{
+	RocksDBHistogramBuckets buckets;
+
+	std::istringstream stream(histogramString);
+	std::string line;
+	while (std::getline(stream, line)) {
+		if (line.empty() || (line[0] != '[' && line[0] != '(')) {
+			continue;
+		}
+
+		uint64_t lower, upper, bucketCount;
+		if (sscanf(line.c_str() + 1, " %" SCNu64 " , %" SCNu64 " ] %" SCNu64, &lower, &upper, &bucketCount) == 3) {
+			buckets[upper] = std::make_pair(lower, bucketCount);
+		}
+	}
+	return buckets;
+}
+
+- (void)setBuckets:(const RocksDBHistogramBuckets &)buckets
+{
+	NSMutableArray *lowerBounds = [NSMutableArray arrayWithCapacity:buckets.size()];
+	NSMutableArray *upperBounds = [NSMutableArray arrayWithCapacity:buckets.size()];
+	NSMutableArray *counts = [NSMutableArray arrayWithCapacity:buckets.size()];
+	for (const auto &bucket : buckets) {
+		[lowerBounds addObject:@(bucket.second.first)];
+		[upperBounds addObject:@(bucket.first)];
+		[counts addObject:@(bucket.second.second)];
+	}
+	self.bucketLowerBounds = lowerBounds;
+	self.bucketUpperBounds = upperBounds;
+	self.bucketCounts = counts;
+}
+
+#pragma mark - Percentiles
+
+- (double)valueAtPercentile:(double)percentile
+{
+	uint64_t total = 0;
+	for (NSNumber *bucketCount in self.bucketCounts) {
+		total += bucketCount.unsignedLongLongValue;
+	}
+	if (total == 0) {
+		return 0;
+	}
+
+	double threshold = total * (percentile / 100.0);
+	uint64_t cumulativeSum = 0;
+
+	for (NSUInteger i = 0; i < self.bucketCounts.count; i++) {
+		uint64_t bucketCount = self.bucketCounts[i].unsignedLongLongValue;
+		cumulativeSum += bucketCount;
+
+		if (cumulativeSum >= threshold) {
+			double left = self.bucketLowerBounds[i].doubleValue;
+			double right = self.bucketUpperBounds[i].doubleValue;
+			uint64_t leftSum = cumulativeSum - bucketCount;
+			double position = bucketCount > 0 ? (threshold - leftSum) / bucketCount : 0;
+			double value = left + (right - left) * position;
+			return std::min(std::max(value, self.min), self.max);
+		}
+	}
+	return self.max;
+}
+
+#pragma mark - Merge
+
+- (RocksDBStatisticsHistogram *)histogramByMergingHistogram:(RocksDBStatisticsHistogram *)histogram
+{
+	RocksDBStatisticsHistogram *merged = [RocksDBStatisticsHistogram new];
+	merged.ticker = self.ticker;
+
+	if (self.count == 0 || histogram.count == 0) {
+		RocksDBStatisticsHistogram *source = self.count == 0 ? histogram : self;
+		merged.min = source.min;
+		merged.max = source.max;
+		merged.average = source.average;
+		merged.standardDeviation = source.standardDeviation;
+	} else {
+		merged.min = std::min(self.min, histogram.min);
+		merged.max = std::max(self.max, histogram.max);
+	}
+	merged.count = self.count + histogram.count;
+	merged.sum = self.sum + histogram.sum;
+
+	if (self.count > 0 && histogram.count > 0) {
+		// Combine the population variances via the sums of squares of both histograms
+		double n1 = self.count, n2 = histogram.count;
+		double squares1 = n1 * (pow(self.standardDeviation, 2) + pow(self.average, 2));
+		double squares2 = n2 * (pow(histogram.standardDeviation, 2) + pow(histogram.average, 2));
+		merged.average = static_cast<double>(merged.sum) / merged.count;
+		merged.standardDeviation = sqrt(std::max((squares1 + squares2) / (n1 + n2) - pow(merged.average, 2), 0.0));
+	}
+
+	// Both histograms share RocksDB's fixed bucket layout, thus buckets can be matched by their upper bound
+	RocksDBHistogramBuckets buckets;
+	for (RocksDBStatisticsHistogram *source in @[self, histogram]) {
+		for (NSUInteger i = 0; i < source.bucketCounts.count; i++) {
+			auto &bucket = buckets[source.bucketUpperBounds[i].unsignedLongLongValue];
+			bucket.first = source.bucketLowerBounds[i].unsignedLongLongValue;
+			bucket.second += source.bucketCounts[i].unsignedLongLongValue;
+		}
+	}
+
+	[merged setBuckets:buckets];
+
+	merged.median = [merged valueAtPercentile:50];
+	merged.percentile95 = [merged valueAtPercentile:95];
+	merged.percentile99 = [merged valueAtPercentile:99];
+	merged.percentile999 = [merged valueAtPercentile:99.9];
+
+	return merged;
+}
+
+#pragma mark - Description
 
 - (NSString *)description
 {
-	return [NSString stringWithFormat:@"<Histogram Type: %@, Median: %f, Percentile 95: %f, Pernectile 99: %f, Average: %f, Standard Deviation: %f>",
+	return [NSString stringWithFormat:@"<Histogram Type: %@, Count: %llu, Sum: %llu, Min: %f, Median: %f, Percentile 95: %f, Percentile 99: %f, Percentile 99.9: %f, Max: %f, Average: %f, Standard Deviation: %f>",
 			self.ticker,
+			self.count,
+			self.sum,
+			self.min,
 			self.median,
 			self.percentile95,
 			self.percentile99,
+			self.percentile999,
+			self.max,
 			self.average,
 			self.standardDeviation];
 }
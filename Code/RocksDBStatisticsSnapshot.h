@@ -0,0 +1,97 @@
+//
+//  RocksDBStatisticsSnapshot.h
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "RocksDBStatistics.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ An immutable, point-in-time capture of all tickers and histograms of a `RocksDBStatistics` object.
+
+ @discussion All values are captured at once and stored natively, thus reading a value from the
+ snapshot doesn't call into RocksDB and doesn't allocate any objects. Rates can be computed by taking
+ periodic snapshots and calling `deltaFromSnapshot:` on the most recent one.
+
+ @see RocksDBStatistics
+ */
+@interface RocksDBStatisticsSnapshot : NSObject
+
+/** @brief The time at which the snapshot was taken, in seconds since the reference date. */
+@property (nonatomic, assign, readonly) NSTimeInterval timestamp;
+
+/**
+ @brief The time span covered by the values in this snapshot, in seconds.
+
+ @discussion This is 0 for snapshots taken from a `RocksDBStatistics` object, whose values are
+ cumulative, and the time elapsed between both snapshots for a delta.
+ */
+@property (nonatomic, assign, readonly) NSTimeInterval interval;
+
+/**
+ Returns the value for the given ticker.
+
+ @param ticker The ticker type to get.
+ @return The value for the given ticker type.
+ */
+- (uint64_t)countForTicker:(RocksDBTicker)ticker;
+
+/**
+ Returns the rate per second of the given ticker, i.e. its value divided by the `interval`.
+
+ @param ticker The ticker type to get.
+ @return The rate per second for the given ticker type, or 0 if the snapshot isn't a delta.
+ */
+- (double)rateForTicker:(RocksDBTicker)ticker;
+
+/**
+ Returns the number of values recorded in the given histogram.
+
+ @param type The type of the histogram to get.
+ @return The number of values recorded in the given histogram.
+ */
+- (uint64_t)countForHistogram:(RocksDBHistogram)type;
+
+/**
+ Returns the sum of the values recorded in the given histogram.
+
+ @param type The type of the histogram to get.
+ @return The sum of the values recorded in the given histogram.
+ */
+- (uint64_t)sumForHistogram:(RocksDBHistogram)type;
+
+/**
+ Returns the histogram for the given histogram type.
+
+ @discussion A new `RocksDBStatisticsHistogram` object is created on each call. For a delta the
+ count, sum, average, buckets and percentiles cover only the values recorded between both snapshots,
+ while the minimum, maximum and standard deviation, which cannot be subtracted, are those of the more
+ recent snapshot.
+
+ @param type The type of the histogram to get.
+ @return The value for the given histogram type.
+
+ @see RocksDBStatisticsHistogram
+ */
+- (RocksDBStatisticsHistogram *)histogramDataForType:(RocksDBHistogram)type;
+
+/**
+ Returns a new snapshot holding the difference between the receiver and an earlier snapshot
+ taken from the same `RocksDBStatistics` object.
+
+ @discussion Counters that went down in the meantime, e.g. because the statistics were reset,
+ are reported as their current value.
+
+ @param snapshot The earlier snapshot.
+ @return A new snapshot holding the values recorded between both snapshots.
+ */
+- (RocksDBStatisticsSnapshot *)deltaFromSnapshot:(RocksDBStatisticsSnapshot *)snapshot;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,160 @@
+//
+//  RocksDBStatisticsSnapshot.mm
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#import "RocksDBStatisticsSnapshot.h"
+
+#import <rocksdb/statistics.h>
+
+#include <algorithm>
+#include <map>
+#include <vector>
+
+/** Non-empty buckets keyed by their inclusive upper bound, holding their exclusive lower bound and count. */
+typedef std::map<uint64_t, std::pair<uint64_t, uint64_t>> RocksDBHistogramBuckets;
+
+#pragma mark - Informal Protocols
+
+@interface RocksDBStatisticsSnapshot ()
+{
+	std::vector<uint64_t> _tickers;
+	std::vector<rocksdb::HistogramData> _histograms;
+	std::vector<RocksDBHistogramBuckets> _buckets;
+}
+@property (nonatomic, assign) NSTimeInterval timestamp;
+@property (nonatomic, assign) NSTimeInterval interval;
+@end
+
+@interface RocksDBStatisticsHistogram ()
+- (instancetype)initWithType:(uint32_t)type
+						data:(const rocksdb::HistogramData &)data
+					 buckets:(const RocksDBHistogramBuckets &)buckets;
++ (RocksDBHistogramBuckets)bucketsFromHistogramString:(const std::string &)histogramString;
+@end
+
+#pragma mark - Impl
+
+@implementation RocksDBStatisticsSnapshot
+@synthesize timestamp = _timestamp;
+@synthesize interval = _interval;
+
+#pragma mark - Lifecycle
+
+- (instancetype)initWithNativeStatistics:(const std::shared_ptr<rocksdb::Statistics> &)statistics
+{
+	self = [super init];
+	if (self) {
+		_timestamp = [NSDate timeIntervalSinceReferenceDate];
+		_interval = 0;
+
+		_tickers.resize(rocksdb::TICKER_ENUM_MAX);
+		for (uint32_t ticker = 0; ticker < rocksdb::TICKER_ENUM_MAX; ticker++) {
+			_tickers[ticker] = statistics->getTickerCount(ticker);
+		}
+
+		_histograms.resize(rocksdb::HISTOGRAM_ENUM_MAX);
+		_buckets.resize(rocksdb::HISTOGRAM_ENUM_MAX);
+		for (uint32_t type = 0; type < rocksdb::HISTOGRAM_ENUM_MAX; type++) {
+			statistics->histogramData(type, &_histograms[type]);
+			_buckets[type] = [RocksDBStatisticsHistogram bucketsFromHistogramString:statistics->getHistogramString(type)];
+		}
+	}
+	return self;
+}
+
+- (instancetype)initWithSnapshot:(RocksDBStatisticsSnapshot *)snapshot previous:(RocksDBStatisticsSnapshot *)previous
+{
+	self = [super init];
+	if (self) {
+		_timestamp = snapshot->_timestamp;
+		_interval = MAX(snapshot->_timestamp - previous->_timestamp, 0);
+
+		_tickers = snapshot->_tickers;
+		for (size_t i = 0; i < _tickers.size() && i < previous->_tickers.size(); i++) {
+			if (_tickers[i] >= previous->_tickers[i]) {
+				_tickers[i] -= previous->_tickers[i];
+			}
+		}
+
+		_histograms = snapshot->_histograms;
+		_buckets = snapshot->_buckets;
+		for (size_t i = 0; i < _histograms.size() && i < previous->_histograms.size(); i++) {
+			rocksdb::HistogramData &data = _histograms[i];
+			const rocksdb::HistogramData &earlier = previous->_histograms[i];
+			if (data.count < earlier.count || data.sum < earlier.sum) {
+				// The statistics were reset in the meantime
+				continue;
+			}
+
+			data.count -= earlier.count;
+			data.sum -= earlier.sum;
+			data.average = data.count > 0 ? static_cast<double>(data.sum) / data.count : 0;
+
+			// Buckets only ever fill up, thus they can be matched by their upper bound and subtracted
+			RocksDBHistogramBuckets &buckets = _buckets[i];
+			for (const auto &bucket : previous->_buckets[i]) {
+				auto it = buckets.find(bucket.first);
+				if (it == buckets.end()) {
+					continue;
+				}
+				it->second.second -= std::min(it->second.second, bucket.second.second);
+				if (it->second.second == 0) {
+					buckets.erase(it);
+				}
+			}
+
+			if (data.count > 0) {
+				RocksDBStatisticsHistogram *histogram = [[RocksDBStatisticsHistogram alloc] initWithType:(uint32_t)i
+																									data:data
+																								 buckets:buckets];
+				data.median = [histogram valueAtPercentile:50];
+				data.percentile95 = [histogram valueAtPercentile:95];
+				data.percentile99 = [histogram valueAtPercentile:99];
+			}
+		}
+	}
+	return self;
+}
+
+#pragma mark - Accessor
+
+- (uint64_t)countForTicker:(RocksDBTicker)ticker
+{
+	return ticker < _tickers.size() ? _tickers[ticker] : 0;
+}
+
+- (double)rateForTicker:(RocksDBTicker)ticker
+{
+	return _interval > 0 ? [self countForTicker:ticker] / _interval : 0;
+}
+
+- (uint64_t)countForHistogram:(RocksDBHistogram)type
+{
+	return type < _histograms.size() ? _histograms[type].count : 0;
+}
+
+- (uint64_t)sumForHistogram:(RocksDBHistogram)type
+{
+	return type < _histograms.size() ? _histograms[type].sum : 0;
+}
+
+- (RocksDBStatisticsHistogram *)histogramDataForType:(RocksDBHistogram)type
+{
+	if (type >= _histograms.size()) {
+		return [RocksDBStatisticsHistogram new];
+	}
+	return [[RocksDBStatisticsHistogram alloc] initWithType:type data:_histograms[type] buckets:_buckets[type]];
+}
+
+#pragma mark - Delta
+
+- (RocksDBStatisticsSnapshot *)deltaFromSnapshot:(RocksDBStatisticsSnapshot *)snapshot
+{
+	return [[RocksDBStatisticsSnapshot alloc] initWithSnapshot:self previous:snapshot];
+}
+
+@end
@@ -0,0 +1,63 @@
+//
+//  RocksDBWriteBufferManager.h
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class RocksDBCache;
+
+/**
+ A `RocksDBWriteBufferManager` enforces a memory budget for the memtables of all column families of all
+ database instances it is shared with.
+
+ @discussion When the memtables' total memory usage approaches the buffer size, the database which is
+ currently writing flushes its largest memtable. Optionally, the memory used by the memtables is charged
+ to a cache, e.g. the block cache shared by the databases, so that a single capacity bounds the memory
+ used by both memtables and cached blocks.
+
+ @see RocksDBDatabaseOptions
+ */
+@interface RocksDBWriteBufferManager : NSObject
+
+/**
+ Creates a new write buffer manager with the given memtable budget.
+
+ @param bufferSize The memory budget for all memtables in bytes, or 0 to disable the budget.
+ @return A new write buffer manager.
+ */
++ (instancetype)writeBufferManagerWithBufferSize:(size_t)bufferSize;
+
+/**
+ Creates a new write buffer manager with the given memtable budget, which charges the memtables' memory to
+ the given cache.
+
+ @discussion The memory is charged by inserting dummy entries into the cache, thus the cache's `usage`
+ includes the memtables' memory. Charging the cache is not supported in RocksDB Lite.
+
+ @param bufferSize The memory budget for all memtables in bytes.
+ @param cache The cache to charge the memtables' memory to.
+ @return A new write buffer manager.
+ */
++ (instancetype)writeBufferManagerWithBufferSize:(size_t)bufferSize cache:(nullable RocksDBCache *)cache;
+
+/** @brief The memory budget for all memtables in bytes. */
+@property (nonatomic, assign, readonly) size_t bufferSize;
+
+/** @brief Whether the memtable budget is enforced, i.e. the buffer size is greater than 0. */
+@property (nonatomic, assign, readonly, getter=isEnabled) BOOL enabled;
+
+/** @brief The memory used by all memtables, including the immutable ones being flushed, in bytes. */
+@property (nonatomic, assign, readonly) size_t memoryUsage;
+
+/** @brief The memory used by the mutable memtables in bytes. */
+@property (nonatomic, assign, readonly) size_t mutableMemTableMemoryUsage;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,87 @@
+//
+//  RocksDBWriteBufferManager.mm
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#import "RocksDBWriteBufferManager.h"
+#import "RocksDBCache.h"
+
+#import <rocksdb/cache.h>
+#import <rocksdb/write_buffer_manager.h>
+
+#pragma mark - Informal Protocols
+
+@interface RocksDBCache ()
+@property (nonatomic, assign) std::shared_ptr<rocksdb::Cache> cache;
+@end
+
+#pragma mark - Impl
+
+@interface RocksDBWriteBufferManager ()
+{
+	std::shared_ptr<rocksdb::WriteBufferManager> _writeBufferManager;
+}
+@property (nonatomic, assign) std::shared_ptr<rocksdb::WriteBufferManager> writeBufferManager;
+@end
+
+@implementation RocksDBWriteBufferManager
+@synthesize writeBufferManager = _writeBufferManager;
+
+#pragma mark - Lifecycle
+
++ (instancetype)writeBufferManagerWithBufferSize:(size_t)bufferSize
+{
+	return [self writeBufferManagerWithBufferSize:bufferSize cache:nil];
+}
+
++ (instancetype)writeBufferManagerWithBufferSize:(size_t)bufferSize cache:(RocksDBCache *)cache
+{
+	std::shared_ptr<rocksdb::Cache> nativeCache = cache != nil ? cache.cache : nullptr;
+	return [[RocksDBWriteBufferManager alloc] initWithNativeWriteBufferManager:
+			std::make_shared<rocksdb::WriteBufferManager>(bufferSize, nativeCache)];
+}
+
+- (instancetype)initWithNativeWriteBufferManager:(std::shared_ptr<rocksdb::WriteBufferManager>)writeBufferManager
+{
+	self = [super init];
+	if (self) {
+		_writeBufferManager = writeBufferManager;
+	}
+	return self;
+}
+
+- (void)dealloc
+{
+	@synchronized(self) {
+		if (_writeBufferManager != nullptr) {
+			_writeBufferManager.reset();
+		}
+	}
+}
+
+#pragma mark - Accessor
+
+- (size_t)bufferSize
+{
+	return _writeBufferManager->buffer_size();
+}
+
+- (BOOL)isEnabled
+{
+	return _writeBufferManager->enabled();
+}
+
+- (size_t)memoryUsage
+{
+	return _writeBufferManager->memory_usage();
+}
+
+- (size_t)mutableMemTableMemoryUsage
+{
+	return _writeBufferManager->mutable_memtable_memory_usage();
+}
+
+@end
@@ -0,0 +1,217 @@
+//
+//  RocksDBBlockBasedTableOptionsTests.mm
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#import "RocksDBTests.h"
+
+@interface RocksDBBlockBasedTableOptionsTests : RocksDBTests
+@end
+
+@implementation RocksDBBlockBasedTableOptionsTests
+
+- (void)openDatabaseWithTableOptions:(void (^)(RocksDBBlockBasedTableOptions *options))tableOptionsBlock
+{
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.tableFacotry = [RocksDBTableFactory blockBasedTableFactoryWithOptions:tableOptionsBlock];
+	}];
+}
+
+- (void)populateDatabase
+{
+	for (int i = 0; i < 10000; i++) {
+		NSString *str = [NSString stringWithFormat:@"a%05d", i];
+		[_rocks setData:str.data forKey:str.data error:nil];
+	}
+	[_rocks compactRange:RocksDBOpenRange withOptions:nil error:nil];
+}
+
+- (void)testTableOptions_PartitionedIndexAndFilters
+{
+	RocksDBCache *cache = [RocksDBCache LRUCacheWithCapacity:8 * 1024 * 1024];
+
+	[self openDatabaseWithTableOptions:^(RocksDBBlockBasedTableOptions *options) {
+		options.blockCache = cache;
+		options.indexType = BlockBasedTableIndexTwoLevelIndexSearch;
+		options.partitionFilters = YES;
+		options.metadataBlockSize = 256;
+		options.filterPolicy = [RocksDBFilterPolicy bloomFilterPolicyWithBitsPerKey:10 useBlockBasedBuilder:NO];
+		options.cacheIndexAndFilterBlocks = YES;
+		options.pinTopLevelIndexAndFilter = YES;
+		options.pinL0FilterAndIndexBlocksInCache = YES;
+
+		XCTAssertEqual(options.indexType, BlockBasedTableIndexTwoLevelIndexSearch);
+		XCTAssertTrue(options.partitionFilters);
+		XCTAssertEqual(options.metadataBlockSize, 256);
+		XCTAssertTrue(options.pinTopLevelIndexAndFilter);
+		XCTAssertTrue(options.pinL0FilterAndIndexBlocksInCache);
+	}];
+	XCTAssertNotNil(_rocks);
+
+	[self populateDatabase];
+
+	XCTAssertEqualObjects([_rocks dataForKey:@"a04242".data error:nil], @"a04242".data);
+	XCTAssertNil([_rocks dataForKey:@"b".data error:nil]);
+	XCTAssertGreaterThan(cache.usage, 0);
+
+#if !(defined(ROCKSDB_LITE) && defined(TARGET_OS_IPHONE))
+	NSString *tableProperties = [_rocks valueForProperty:RocksDBPropertyAggregatedTableProperties];
+	XCTAssertTrue([tableProperties containsString:@"# index partitions"]);
+#endif
+}
+
+- (void)testTableOptions_PartitionFiltersRequireTwoLevelIndex
+{
+	[self openDatabaseWithTableOptions:^(RocksDBBlockBasedTableOptions *options) {
+		options.indexType = BlockBasedTableIndexBinarySearch;
+		options.partitionFilters = YES;
+		options.filterPolicy = [RocksDBFilterPolicy bloomFilterPolicyWithBitsPerKey:10 useBlockBasedBuilder:NO];
+	}];
+	// The table factory resets `partitionFilters` instead of failing
+	XCTAssertNotNil(_rocks);
+
+	[self populateDatabase];
+	XCTAssertEqualObjects([_rocks dataForKey:@"a04242".data error:nil], @"a04242".data);
+	XCTAssertNil([_rocks dataForKey:@"b".data error:nil]);
+
+#if !(defined(ROCKSDB_LITE) && defined(TARGET_OS_IPHONE))
+	NSString *tableProperties = [_rocks valueForProperty:RocksDBPropertyAggregatedTableProperties];
+	XCTAssertFalse([tableProperties containsString:@"# index partitions"]);
+
+	// The persisted OPTIONS file holds the table options as sanitized by the factory
+	NSArray<NSString *> *files = [[NSFileManager defaultManager] contentsOfDirectoryAtPath:_path error:nil];
+	NSString *optionsFile = [files filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"SELF BEGINSWITH 'OPTIONS-'"]].lastObject;
+	XCTAssertNotNil(optionsFile);
+
+	NSString *persistedOptions = [NSString stringWithContentsOfFile:[_path stringByAppendingPathComponent:optionsFile]
+														   encoding:NSUTF8StringEncoding
+															  error:nil];
+	XCTAssertTrue([persistedOptions containsString:@"partition_filters=false"]);
+#endif
+}
+
+- (void)testTableOptions_DataBlockHashIndex
+{
+	[self openDatabaseWithTableOptions:^(RocksDBBlockBasedTableOptions *options) {
+		XCTAssertEqual(options.dataBlockIndexType, BlockBasedTableDataBlockIndexBinarySearch);
+		XCTAssertEqual(options.dataBlockHashTableUtilRatio, 0.75);
+
+		options.dataBlockIndexType = BlockBasedTableDataBlockIndexBinaryAndHash;
+		options.dataBlockHashTableUtilRatio = 0.5;
+
+		XCTAssertEqual(options.dataBlockIndexType, BlockBasedTableDataBlockIndexBinaryAndHash);
+		XCTAssertEqual(options.dataBlockHashTableUtilRatio, 0.5);
+	}];
+	[self populateDatabase];
+
+	XCTAssertEqualObjects([_rocks dataForKey:@"a04242".data error:nil], @"a04242".data);
+	XCTAssertNil([_rocks dataForKey:@"a04242x".data error:nil]);
+
+	RocksDBIterator *iterator = [_rocks iterator];
+	[iterator seekToKey:@"a04242x".data];
+	XCTAssertEqualObjects([iterator key], @"a04243".data);
+	[iterator close];
+}
+
+#if !(defined(ROCKSDB_LITE) && defined(TARGET_OS_IPHONE))
+
+- (uint64_t)indexAndFilterBytesLoadedForLookupWithTableOptions:(void (^)(RocksDBBlockBasedTableOptions *options))tableOptionsBlock
+{
+	RocksDBCache *cache = [RocksDBCache LRUCacheWithCapacity:8 * 1024 * 1024];
+	RocksDBStatistics *statistics = [RocksDBStatistics new];
+
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.statistics = statistics;
+		options.tableFacotry = [RocksDBTableFactory blockBasedTableFactoryWithOptions:^(RocksDBBlockBasedTableOptions *tableOptions) {
+			tableOptions.blockCache = cache;
+			tableOptions.metadataBlockSize = 256;
+			tableOptions.filterPolicy = [RocksDBFilterPolicy bloomFilterPolicyWithBitsPerKey:10 useBlockBasedBuilder:NO];
+			tableOptions.cacheIndexAndFilterBlocks = YES;
+			tableOptionsBlock(tableOptions);
+		}];
+	}];
+	[self populateDatabase];
+	[_rocks dataForKey:@"a04242".data error:nil];
+
+	// Evict everything loaded while opening the table, so that the lookup starts with a cold cache
+	cache.capacity = 0;
+	cache.capacity = 8 * 1024 * 1024;
+
+	uint64_t indexBytes = [statistics countForTicker:RocksDBTickerBlockCacheIndexBytesInsert];
+	uint64_t filterBytes = [statistics countForTicker:RocksDBTickerBlockCacheFilterBytesInsert];
+	[_rocks dataForKey:@"a04242".data error:nil];
+	uint64_t loadedBytes = [statistics countForTicker:RocksDBTickerBlockCacheIndexBytesInsert] - indexBytes
+		+ [statistics countForTicker:RocksDBTickerBlockCacheFilterBytesInsert] - filterBytes;
+
+	[_rocks close];
+	[[NSFileManager defaultManager] removeItemAtPath:_path error:nil];
+	return loadedBytes;
+}
+
+- (void)testTableOptions_PartitionedIndex_BytesLoadedPerLookup
+{
+	// Index and filter blocks live in the block cache in both runs
+	uint64_t monolithicBytes = [self indexAndFilterBytesLoadedForLookupWithTableOptions:^(RocksDBBlockBasedTableOptions *options) {
+		options.indexType = BlockBasedTableIndexBinarySearch;
+	}];
+	uint64_t partitionedBytes = [self indexAndFilterBytesLoadedForLookupWithTableOptions:^(RocksDBBlockBasedTableOptions *options) {
+		options.indexType = BlockBasedTableIndexTwoLevelIndexSearch;
+		options.partitionFilters = YES;
+	}];
+
+	XCTAssertGreaterThan(monolithicBytes, 0);
+	// A lookup loads the top-level index and a single partition instead of the whole index and filter
+	XCTAssertLessThan(partitionedBytes, monolithicBytes);
+}
+
+#endif
+
+#pragma mark - Performance
+
+- (void)measureCachedPointLookups
+{
+	[self populateDatabase];
+
+	NSMutableArray<NSData *> *keys = [NSMutableArray arrayWithCapacity:10000];
+	for (int i = 0; i < 10000; i++) {
+		[keys addObject:[NSString stringWithFormat:@"a%05d", (i * 7919) % 10000].data];
+	}
+	// Load all data blocks into the block cache
+	for (NSData *key in keys) {
+		[_rocks dataForKey:key error:nil];
+	}
+
+	[self measureBlock:^{
+		for (int round = 0; round < 10; round++) {
+			for (NSData *key in keys) {
+				[_rocks dataForKey:key error:nil];
+			}
+		}
+	}];
+}
+
+- (void)testPerformance_TableOptions_DataBlockIndex_BinarySearch
+{
+	[self openDatabaseWithTableOptions:^(RocksDBBlockBasedTableOptions *options) {
+		options.blockCache = [RocksDBCache LRUCacheWithCapacity:64 * 1024 * 1024];
+		options.dataBlockIndexType = BlockBasedTableDataBlockIndexBinarySearch;
+	}];
+	[self measureCachedPointLookups];
+}
+
+- (void)testPerformance_TableOptions_DataBlockIndex_BinaryAndHash
+{
+	[self openDatabaseWithTableOptions:^(RocksDBBlockBasedTableOptions *options) {
+		options.blockCache = [RocksDBCache LRUCacheWithCapacity:64 * 1024 * 1024];
+		options.dataBlockIndexType = BlockBasedTableDataBlockIndexBinaryAndHash;
+		options.dataBlockHashTableUtilRatio = 0.75;
+	}];
+	[self measureCachedPointLookups];
+}
+
+@end
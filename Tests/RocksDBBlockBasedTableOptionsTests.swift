@@ -0,0 +1,49 @@
+//
+//  RocksDBBlockBasedTableOptionsTests.swift
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+import XCTest
+import ObjectiveRocks
+
+class RocksDBBlockBasedTableOptionsTests : RocksDBTests {
+
+	func testSwift_TableOptions_PartitionedIndexAndFilters() {
+		rocks = RocksDB.database(atPath: self.path, andDBOptions: { (options) -> Void in
+			options.createIfMissing = true
+			options.tableFacotry = RocksDBTableFactory.blockBasedTableFactory(options: { (options) -> Void in
+				options.indexType = .twoLevelIndexSearch
+				options.partitionFilters = true
+				options.filterPolicy = RocksDBFilterPolicy.bloomFilterPolicy(withBitsPerKey: 10, useBlockBasedBuilder: false)
+				options.cacheIndexAndFilterBlocks = true
+				options.pinTopLevelIndexAndFilter = true
+				options.pinL0FilterAndIndexBlocksInCache = true
+			})
+		})
+
+		XCTAssertNotNil(rocks)
+
+		try! rocks.setData("value 1", forKey: "key 1")
+		try! rocks.compactRange(RocksDBOpenRange, withOptions: nil)
+
+		XCTAssertEqual(try! rocks.data(forKey: "key 1"), "value 1".data)
+	}
+
+	func testSwift_TableOptions_DataBlockHashIndex() {
+		rocks = RocksDB.database(atPath: self.path, andDBOptions: { (options) -> Void in
+			options.createIfMissing = true
+			options.tableFacotry = RocksDBTableFactory.blockBasedTableFactory(options: { (options) -> Void in
+				options.dataBlockIndexType = .binaryAndHash
+				options.dataBlockHashTableUtilRatio = 0.5
+			})
+		})
+
+		try! rocks.setData("value 1", forKey: "key 1")
+		try! rocks.compactRange(RocksDBOpenRange, withOptions: nil)
+
+		XCTAssertEqual(try! rocks.data(forKey: "key 1"), "value 1".data)
+	}
+}
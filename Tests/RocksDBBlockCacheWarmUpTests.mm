@@ -0,0 +1,196 @@
+//
+//  RocksDBBlockCacheWarmUpTests.mm
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#import "RocksDBTests.h"
+
+@interface RocksDBBlockCacheWarmUpTests : RocksDBTests
+{
+	RocksDBCache *_cache;
+	RocksDBStatistics *_statistics;
+}
+@end
+
+@implementation RocksDBBlockCacheWarmUpTests
+
+- (void)openDatabase
+{
+	[self openDatabaseWithHotKeysFilePath:nil];
+}
+
+- (void)openDatabaseWithHotKeysFilePath:(NSString *)hotKeysFilePath
+{
+	_cache = [RocksDBCache LRUCacheWithCapacity:64 * 1024 * 1024];
+	_statistics = [RocksDBStatistics new];
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.statistics = _statistics;
+		options.maxOpenFiles = -1;
+		options.hotKeysFilePath = hotKeysFilePath;
+		options.tableFacotry = [RocksDBTableFactory blockBasedTableFactoryWithOptions:^(RocksDBBlockBasedTableOptions *options) {
+			options.blockCache = _cache;
+			options.cacheIndexAndFilterBlocks = YES;
+			options.filterPolicy = [RocksDBFilterPolicy bloomFilterPolicyWithBitsPerKey:10];
+		}];
+	}];
+}
+
+- (void)populateDatabase
+{
+	[self openDatabase];
+
+	NSMutableData *value = [NSMutableData dataWithLength:1024];
+	for (int i = 0; i < 10000; i++) {
+		NSString *key = [NSString stringWithFormat:@"a%05d", i];
+		[_rocks setData:value forKey:key.data error:nil];
+	}
+	[_rocks compactRange:RocksDBOpenRange withOptions:nil error:nil];
+	[_rocks close];
+}
+
+- (void)waitForWarmUp:(void (^)(void (^completion)(NSError *error)))warmUp
+{
+	XCTestExpectation *expectation = [self expectationWithDescription:@"warm-up"];
+	warmUp(^(NSError *error) {
+		XCTAssertNil(error);
+		[expectation fulfill];
+	});
+	[self waitForExpectationsWithTimeout:10 handler:nil];
+}
+
+- (void)testWarmUp_IndexAndFilterBlocks
+{
+	[self populateDatabase];
+	[self openDatabase];
+
+	// Opening the table files may already load their index blocks, thus start with a cold cache
+	_cache.capacity = 0;
+	_cache.capacity = 64 * 1024 * 1024;
+	size_t usage = _cache.usage;
+	uint64_t indexAdds = [_statistics countForTicker:RocksDBTickerBlockCacheIndexAdd];
+
+	[self waitForWarmUp:^(void (^completion)(NSError *)) {
+		[_rocks warmUpBlockCacheForRanges:nil completion:completion];
+	}];
+	XCTAssertGreaterThan(_cache.usage, usage);
+	XCTAssertGreaterThan([_statistics countForTicker:RocksDBTickerBlockCacheIndexAdd], indexAdds);
+}
+
+- (void)testWarmUp_Ranges
+{
+	[self populateDatabase];
+	[self openDatabase];
+
+	[self waitForWarmUp:^(void (^completion)(NSError *)) {
+		[_rocks warmUpBlockCacheForRanges:nil completion:completion];
+	}];
+	size_t usage = _cache.usage;
+
+	[self waitForWarmUp:^(void (^completion)(NSError *)) {
+		[_rocks warmUpBlockCacheForRanges:@[RocksDBMakeKeyRange(@"a01000".data, @"a03000".data)] completion:completion];
+	}];
+	// 2000 values of 1KB each
+	XCTAssertGreaterThan(_cache.usage, usage + 2000 * 1024);
+}
+
+- (void)testWarmUp_HotKeys
+{
+	[self populateDatabase];
+	[self openDatabase];
+
+	[_rocks startTrackingHotKeysWithCapacity:100];
+	for (int round = 0; round < 100; round++) {
+		for (int i = 0; i < 10; i++) {
+			NSString *key = [NSString stringWithFormat:@"a%05d", i * 1000];
+			[_rocks dataForKey:key.data error:nil];
+		}
+	}
+
+	NSString *dumpPath = [_backupPath stringByAppendingPathExtension:@"plist"];
+	NSError *error = nil;
+	XCTAssertTrue([_rocks dumpHotKeysToFileAtPath:dumpPath error:&error]);
+	XCTAssertNil(error);
+
+	NSArray *keys = [NSArray arrayWithContentsOfFile:dumpPath];
+	XCTAssertGreaterThan(keys.count, 0);
+	XCTAssertLessThanOrEqual(keys.count, 10);
+	for (NSData *key in keys) {
+		NSString *str = [[NSString alloc] initWithData:key encoding:NSUTF8StringEncoding];
+		XCTAssertEqual([str substringFromIndex:1].intValue % 1000, 0);
+	}
+
+	[_rocks close];
+	[self openDatabase];
+
+	size_t usage = _cache.usage;
+	[self waitForWarmUp:^(void (^completion)(NSError *)) {
+		[_rocks warmUpBlockCacheFromHotKeysFileAtPath:dumpPath completion:completion];
+	}];
+	XCTAssertGreaterThan(_cache.usage, usage);
+
+	[[NSFileManager defaultManager] removeItemAtPath:dumpPath error:nil];
+}
+
+- (void)testWarmUp_HotKeysFilePath
+{
+	NSString *dumpPath = [_backupPath stringByAppendingPathExtension:@"plist"];
+
+	[self populateDatabase];
+	[self openDatabase];
+	size_t usage = _cache.usage;
+	[_rocks close];
+
+	// A missing file is ignored on open, the keys are dumped on close
+	[self openDatabaseWithHotKeysFilePath:dumpPath];
+	[_rocks startTrackingHotKeysWithCapacity:100];
+	for (int round = 0; round < 100; round++) {
+		for (int i = 0; i < 10; i++) {
+			NSString *key = [NSString stringWithFormat:@"a%05d", i * 1000];
+			[_rocks dataForKey:key.data error:nil];
+		}
+	}
+	[_rocks close];
+	XCTAssertTrue([[NSFileManager defaultManager] fileExistsAtPath:dumpPath]);
+
+	[self openDatabaseWithHotKeysFilePath:dumpPath];
+	RocksDBCache *cache = _cache;
+	[self expectationForPredicate:[NSPredicate predicateWithBlock:^BOOL(id object, NSDictionary *bindings) {
+		return cache.usage > usage;
+	}] evaluatedWithObject:self handler:nil];
+	[self waitForExpectationsWithTimeout:10 handler:nil];
+
+	[[NSFileManager defaultManager] removeItemAtPath:dumpPath error:nil];
+}
+
+- (void)testWarmUp_CloseCancelsWarmUp
+{
+	[self populateDatabase];
+	[self openDatabase];
+
+	XCTestExpectation *expectation = [self expectationWithDescription:@"warm-up"];
+	[_rocks warmUpBlockCacheForRanges:@[RocksDBOpenRange] completion:^(NSError *error) {
+		[expectation fulfill];
+	}];
+	[_rocks close];
+
+	[self waitForExpectationsWithTimeout:10 handler:nil];
+}
+
+- (void)testWarmUp_HotKeys_MissingFile
+{
+	[self populateDatabase];
+	[self openDatabase];
+
+	XCTestExpectation *expectation = [self expectationWithDescription:@"warm-up"];
+	[_rocks warmUpBlockCacheFromHotKeysFileAtPath:[_backupPath stringByAppendingPathExtension:@"plist"] completion:^(NSError *error) {
+		XCTAssertNotNil(error);
+		[expectation fulfill];
+	}];
+	[self waitForExpectationsWithTimeout:10 handler:nil];
+}
+
+@end
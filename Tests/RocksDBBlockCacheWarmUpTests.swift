@@ -0,0 +1,46 @@
+//
+//  RocksDBBlockCacheWarmUpTests.swift
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+import XCTest
+import ObjectiveRocks
+
+class RocksDBBlockCacheWarmUpTests : RocksDBTests {
+
+	func testSwift_WarmUp() {
+		let cache = RocksDBCache.lruCache(withCapacity: 64 * 1024 * 1024)
+
+		rocks = RocksDB.database(atPath: self.path, andDBOptions: { (options) -> Void in
+			options.createIfMissing = true
+			options.tableFacotry = RocksDBTableFactory.blockBasedTableFactory(options: { (options) -> Void in
+				options.blockCache = cache
+			})
+		})
+
+		try! rocks.setData("value 1", forKey: "key 1")
+		try! rocks.compactRange(RocksDBOpenRange, withOptions: nil)
+
+		let expectation = self.expectation(description: "warm-up")
+		rocks.warmUpBlockCache(for: [RocksDBOpenRange]) { (error) -> Void in
+			XCTAssertNil(error)
+			expectation.fulfill()
+		}
+		waitForExpectations(timeout: 10, handler: nil)
+
+		XCTAssertGreaterThan(cache.usage, 0)
+
+		rocks.startTrackingHotKeys(withCapacity: 100)
+		for _ in 0..<100 {
+			_ = try? rocks.data(forKey: "key 1")
+		}
+
+		let dumpPath = self.backupPath + ".plist"
+		try! rocks.dumpHotKeysToFile(atPath: dumpPath)
+		XCTAssertEqual(NSArray(contentsOfFile: dumpPath)?.count, 1)
+		try? FileManager.default.removeItem(atPath: dumpPath)
+	}
+}
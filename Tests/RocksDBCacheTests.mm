@@ -0,0 +1,128 @@
+//
+//  RocksDBCacheTests.mm
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#import "RocksDBTests.h"
+
+@interface RocksDBCacheTests : RocksDBTests
+@end
+
+@implementation RocksDBCacheTests
+
+- (void)openDatabaseWithCache:(RocksDBCache *)cache
+{
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.tableFacotry = [RocksDBTableFactory blockBasedTableFactoryWithOptions:^(RocksDBBlockBasedTableOptions *options) {
+			options.blockCache = cache;
+			options.cacheIndexAndFilterBlocks = YES;
+			options.cacheIndexAndFilterBlocksWithHighPriority = YES;
+		}];
+	}];
+
+	for (int i = 0; i < 10000; i++) {
+		NSString *str = [NSString stringWithFormat:@"a%05d", i];
+		[_rocks setData:str.data forKey:str.data error:nil];
+	}
+	[_rocks compactRange:RocksDBOpenRange withOptions:nil error:nil];
+}
+
+- (void)testCache_LRU
+{
+	RocksDBCache *cache = [RocksDBCache LRUCacheWithCapacity:1024 * 1024
+											   numShardsBits:2
+										 strictCapacityLimit:NO
+									   highPriorityPoolRatio:0.5];
+	XCTAssertNotNil(cache);
+	XCTAssertEqualObjects(cache.name, @"LRUCache");
+	XCTAssertEqual(cache.capacity, 1024 * 1024);
+	XCTAssertFalse(cache.strictCapacityLimit);
+	XCTAssertEqual(cache.usage, 0);
+
+	[self openDatabaseWithCache:cache];
+
+	XCTAssertEqualObjects([_rocks dataForKey:@"a00042".data error:nil], @"a00042".data);
+	XCTAssertGreaterThan(cache.usage, 0);
+
+	RocksDBIterator *iterator = [_rocks iterator];
+	[iterator seekToFirst];
+	size_t pinnedUsage = cache.pinnedUsage;
+	XCTAssertGreaterThan(pinnedUsage, 0);
+	[iterator close];
+	XCTAssertLessThan(cache.pinnedUsage, pinnedUsage);
+
+	cache.strictCapacityLimit = YES;
+	XCTAssertTrue(cache.strictCapacityLimit);
+
+	cache.capacity = 1024;
+	XCTAssertEqual(cache.capacity, 1024);
+	XCTAssertLessThanOrEqual(cache.usage, 1024);
+}
+
+- (void)testCache_LRU_InvalidArguments
+{
+	XCTAssertNil([RocksDBCache LRUCacheWithCapacity:1024 numShardsBits:20 strictCapacityLimit:NO highPriorityPoolRatio:0]);
+	XCTAssertNil([RocksDBCache LRUCacheWithCapacity:1024 numShardsBits:-1 strictCapacityLimit:NO highPriorityPoolRatio:-0.1]);
+	XCTAssertNil([RocksDBCache LRUCacheWithCapacity:1024 numShardsBits:-1 strictCapacityLimit:NO highPriorityPoolRatio:1.1]);
+}
+
+#if !defined(SUPPORT_CLOCK_CACHE)
+
+- (void)testCache_Clock_NotSupported
+{
+	// Neither the Xcode project nor the podspec build RocksDB with clock cache support
+	XCTAssertNil([RocksDBCache clockCacheWithCapacity:1024 * 1024]);
+	XCTAssertNil([RocksDBCache clockCacheWithCapacity:1024 * 1024 numShardsBits:-1 strictCapacityLimit:NO]);
+}
+
+#else
+
+- (void)testCache_Clock
+{
+	RocksDBCache *cache = [RocksDBCache clockCacheWithCapacity:1024 * 1024];
+	XCTAssertNotNil(cache);
+
+	XCTAssertEqualObjects(cache.name, @"ClockCache");
+	XCTAssertEqual(cache.capacity, 1024 * 1024);
+
+	[self openDatabaseWithCache:cache];
+
+	XCTAssertEqualObjects([_rocks dataForKey:@"a00042".data error:nil], @"a00042".data);
+	XCTAssertGreaterThan(cache.usage, 0);
+}
+
+#endif
+
+- (void)measureConcurrentReadsWithCache:(RocksDBCache *)cache
+{
+	[self openDatabaseWithCache:cache];
+
+	[self measureBlock:^{
+		dispatch_apply(8, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^(size_t thread) {
+			for (int i = 0; i < 10000; i++) {
+				NSString *str = [NSString stringWithFormat:@"a%05d", (int)((i * 7919 + thread) % 10000)];
+				[_rocks dataForKey:str.data error:nil];
+			}
+		});
+	}];
+}
+
+- (void)testPerformance_Cache_LRU_ConcurrentReads
+{
+	[self measureConcurrentReadsWithCache:[RocksDBCache LRUCacheWithCapacity:64 * 1024 * 1024]];
+}
+
+#if defined(SUPPORT_CLOCK_CACHE)
+
+- (void)testPerformance_Cache_Clock_ConcurrentReads
+{
+	[self measureConcurrentReadsWithCache:[RocksDBCache clockCacheWithCapacity:64 * 1024 * 1024]];
+}
+
+#endif
+
+@end
@@ -0,0 +1,35 @@
+//
+//  RocksDBCacheTests.swift
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+import XCTest
+import ObjectiveRocks
+
+class RocksDBCacheTests : RocksDBTests {
+
+	func testSwift_Cache_LRU() {
+		let cache = RocksDBCache.lruCache(withCapacity: 1024 * 1024, numShardsBits: -1, strictCapacityLimit: false, highPriorityPoolRatio: 0.5)!
+
+		rocks = RocksDB.database(atPath: self.path, andDBOptions: { (options) -> Void in
+			options.createIfMissing = true
+			options.tableFacotry = RocksDBTableFactory.blockBasedTableFactory(options: { (options) -> Void in
+				options.blockCache = cache
+			})
+		})
+
+		try! rocks.setData("value 1", forKey: "key 1")
+		try! rocks.compactRange(RocksDBOpenRange, withOptions: nil)
+		_ = try? rocks.data(forKey: "key 1")
+
+		XCTAssertEqual(cache.name, "LRUCache")
+		XCTAssertEqual(cache.capacity, 1024 * 1024)
+		XCTAssertGreaterThan(cache.usage, 0)
+
+		cache.capacity = 2 * 1024 * 1024
+		XCTAssertEqual(cache.capacity, 2 * 1024 * 1024)
+	}
+}
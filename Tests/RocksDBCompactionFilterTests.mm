@@ -0,0 +1,117 @@
+//
+//  RocksDBCompactionFilterTests.mm
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#import "RocksDBTests.h"
+
+@interface RocksDBCompactionFilterTests : RocksDBTests
+@end
+
+@implementation RocksDBCompactionFilterTests
+
+- (void)testCompactionFilter_TimeToLive
+{
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.compactionFilter = [RocksDBCompactionFilter timeToLiveFilterWithInterval:60 * 60];
+	}];
+
+	NSDate *expired = [NSDate dateWithTimeIntervalSinceNow:-2 * 60 * 60];
+	NSDate *recent = [NSDate date];
+
+	[_rocks setData:[RocksDBCompactionFilter dataByAppendingTimestamp:expired toData:@"value 1".data]
+			 forKey:@"key 1".data error:nil];
+	[_rocks setData:[RocksDBCompactionFilter dataByAppendingTimestamp:recent toData:@"value 2".data]
+			 forKey:@"key 2".data error:nil];
+
+	[_rocks compactRange:RocksDBOpenRange withOptions:nil error:nil];
+
+	XCTAssertNil([_rocks dataForKey:@"key 1".data error:nil]);
+
+	NSData *value = [_rocks dataForKey:@"key 2".data error:nil];
+	XCTAssertEqualObjects([RocksDBCompactionFilter dataByRemovingTimestampFromData:value], @"value 2".data);
+}
+
+- (void)testCompactionFilter_TimeToLive_InvalidInterval
+{
+	XCTAssertNil([RocksDBCompactionFilter timeToLiveFilterWithInterval:-1]);
+	XCTAssertNil([RocksDBCompactionFilter timeToLiveFilterWithInterval:NAN]);
+	XCTAssertNil([RocksDBCompactionFilter timeToLiveFilterWithInterval:INFINITY]);
+	XCTAssertNotNil([RocksDBCompactionFilter timeToLiveFilterWithInterval:0]);
+}
+
+- (void)testCompactionFilter_TimeToLive_NoOverflow
+{
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.compactionFilter = [RocksDBCompactionFilter timeToLiveFilterWithInterval:DBL_MAX];
+	}];
+
+	NSDate *expired = [NSDate dateWithTimeIntervalSinceNow:-2 * 60 * 60];
+	NSDate *future = [NSDate dateWithTimeIntervalSinceNow:2 * 60 * 60];
+
+	[_rocks setData:[RocksDBCompactionFilter dataByAppendingTimestamp:expired toData:@"value 1".data]
+			 forKey:@"key 1".data error:nil];
+	[_rocks setData:[RocksDBCompactionFilter dataByAppendingTimestamp:future toData:@"value 2".data]
+			 forKey:@"key 2".data error:nil];
+
+	[_rocks compactRange:RocksDBOpenRange withOptions:nil error:nil];
+
+	// `timestamp + ttl` would wrap around for the maximum time to live and expire both entries
+	XCTAssertNotNil([_rocks dataForKey:@"key 1".data error:nil]);
+	XCTAssertNotNil([_rocks dataForKey:@"key 2".data error:nil]);
+}
+
+- (void)testCompactionFilter_PrefixDrop
+{
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.compactionFilter = [RocksDBCompactionFilter prefixDropFilterWithPrefixes:@[@"session:".data, @"tmp:".data]];
+	}];
+
+	[_rocks setData:@"x".data forKey:@"session:1".data error:nil];
+	[_rocks setData:@"x".data forKey:@"session:2".data error:nil];
+	[_rocks setData:@"x".data forKey:@"tmp:1".data error:nil];
+	[_rocks setData:@"x".data forKey:@"user:1".data error:nil];
+
+	[_rocks compactRange:RocksDBOpenRange withOptions:nil error:nil];
+
+	XCTAssertNil([_rocks dataForKey:@"session:1".data error:nil]);
+	XCTAssertNil([_rocks dataForKey:@"session:2".data error:nil]);
+	XCTAssertNil([_rocks dataForKey:@"tmp:1".data error:nil]);
+	XCTAssertEqualObjects([_rocks dataForKey:@"user:1".data error:nil], @"x".data);
+}
+
+- (void)testCompactionFilter_Block
+{
+	__block NSUInteger calls = 0;
+	RocksDBCompactionFilter *filter = [RocksDBCompactionFilter filterWithName:@"filter"
+																	 andBlock:^BOOL(int level, NSData *key, NSData *value) {
+																		 @synchronized(self) {
+																			 calls++;
+																		 }
+																		 return [value isEqualToData:@"remove".data];
+																	 }];
+
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.compactionFilter = filter;
+	}];
+
+	[_rocks setData:@"keep".data forKey:@"key 1".data error:nil];
+	[_rocks setData:@"remove".data forKey:@"key 2".data error:nil];
+	[_rocks setData:@"keep".data forKey:@"key 3".data error:nil];
+
+	[_rocks compactRange:RocksDBOpenRange withOptions:nil error:nil];
+
+	XCTAssertEqual(calls, 3);
+	XCTAssertEqualObjects([_rocks dataForKey:@"key 1".data error:nil], @"keep".data);
+	XCTAssertNil([_rocks dataForKey:@"key 2".data error:nil]);
+	XCTAssertEqualObjects([_rocks dataForKey:@"key 3".data error:nil], @"keep".data);
+}
+
+@end
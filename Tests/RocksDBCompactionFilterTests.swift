@@ -0,0 +1,71 @@
+//
+//  RocksDBCompactionFilterTests.swift
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+import XCTest
+import ObjectiveRocks
+
+class RocksDBCompactionFilterTests : RocksDBTests {
+
+	func testSwift_CompactionFilter_TimeToLive() {
+		rocks = RocksDB.database(atPath: self.path, andDBOptions: { (options) -> Void in
+			options.createIfMissing = true
+			options.compactionFilter = RocksDBCompactionFilter.timeToLiveFilter(withInterval: 60 * 60)
+		})
+
+		let expired = UInt64(Date(timeIntervalSinceNow: -2 * 60 * 60).timeIntervalSince1970).littleEndian
+		let recent = UInt64(Date().timeIntervalSince1970).littleEndian
+
+		try! rocks.setData("value 1".data + expired.data, forKey: "key 1")
+		try! rocks.setData("value 2".data + recent.data, forKey: "key 2")
+
+		try! rocks.compactRange(RocksDBOpenRange, withOptions: nil)
+
+		XCTAssertNil(try? rocks.data(forKey: "key 1"))
+		XCTAssertEqual(try! rocks.data(forKey: "key 2"), "value 2".data + recent.data)
+	}
+
+	func testSwift_CompactionFilter_PrefixDrop() {
+		rocks = RocksDB.database(atPath: self.path, andDBOptions: { (options) -> Void in
+			options.createIfMissing = true
+			options.compactionFilter = RocksDBCompactionFilter.prefixDropFilter(withPrefixes: ["session:", "tmp:"])
+		})
+
+		try! rocks.setData("x", forKey: "session:1")
+		try! rocks.setData("x", forKey: "session:2")
+		try! rocks.setData("x", forKey: "tmp:1")
+		try! rocks.setData("x", forKey: "user:1")
+
+		try! rocks.compactRange(RocksDBOpenRange, withOptions: nil)
+
+		XCTAssertNil(try? rocks.data(forKey: "session:1"))
+		XCTAssertNil(try? rocks.data(forKey: "session:2"))
+		XCTAssertNil(try? rocks.data(forKey: "tmp:1"))
+		XCTAssertEqual(try! rocks.data(forKey: "user:1"), "x")
+	}
+
+	func testSwift_CompactionFilter_Block() {
+		let filter = RocksDBCompactionFilter(name: "filter") { (level, key, value) -> Bool in
+			return value == "remove"
+		}
+
+		rocks = RocksDB.database(atPath: self.path, andDBOptions: { (options) -> Void in
+			options.createIfMissing = true
+			options.compactionFilter = filter
+		})
+
+		try! rocks.setData("keep", forKey: "key 1")
+		try! rocks.setData("remove", forKey: "key 2")
+		try! rocks.setData("keep", forKey: "key 3")
+
+		try! rocks.compactRange(RocksDBOpenRange, withOptions: nil)
+
+		XCTAssertEqual(try! rocks.data(forKey: "key 1"), "keep")
+		XCTAssertNil(try? rocks.data(forKey: "key 2"))
+		XCTAssertEqual(try! rocks.data(forKey: "key 3"), "keep")
+	}
+}
@@ -8,6 +8,52 @@
 
 #import "RocksDBTests.h"
 
+static NSData * BigEndianData(uint64_t value)
+{
+	uint64_t bigEndian = CFSwapInt64HostToBig(value);
+	return [NSData dataWithBytes:&bigEndian length:sizeof(bigEndian)];
+}
+
+static NSData * BigEndianDoubleData(double value)
+{
+	uint64_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	return BigEndianData(bits);
+}
+
+#if !(defined(ROCKSDB_LITE) && defined(TARGET_OS_IPHONE))
+// Encodes each decimal digit as an even letter, so that the first differing byte of two consecutive
+// keys is always two apart and a shorter separator can be found between them
+static NSData * GappedKeyForIndex(int idx)
+{
+	NSString *padding = [@"" stringByPaddingToLength:200 withString:@"x" startingAtIndex:0];
+	char digits[9] = {};
+	for (int pos = 7; pos >= 0; pos--, idx /= 10) {
+		digits[pos] = 'a' + 2 * (idx % 10);
+	}
+	return [NSString stringWithFormat:@"%s%@", digits, padding].data;
+}
+#endif
+
+static int BytewiseCompare(NSData *key1, NSData *key2)
+{
+	int result = memcmp(key1.bytes, key2.bytes, MIN(key1.length, key2.length));
+	if (result == 0) {
+		result = (key1.length < key2.length) ? -1 : (key1.length > key2.length ? 1 : 0);
+	}
+	return result;
+}
+
+static int ReverseBytewiseCompareFunction(void *context, const char *key1, size_t length1, const char *key2, size_t length2)
+{
+	(*(int *)context)++;
+	int result = memcmp(key1, key2, MIN(length1, length2));
+	if (result == 0) {
+		result = (length1 < length2) ? -1 : (length1 > length2 ? 1 : 0);
+	}
+	return -result;
+}
+
 @interface RocksDBComparatorTests : RocksDBTests
 
 @end
@@ -170,4 +216,312 @@
 	}];
 }
 
+- (void)testComparator_CompareFunction
+{
+	static int calls = 0;
+	RocksDBComparator *comparator = [[RocksDBComparator alloc] initWithName:@"reverse"
+																	context:&calls
+															compareFunction:&ReverseBytewiseCompareFunction];
+
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.comparator = comparator;
+	}];
+
+	[_rocks setData:@"abc1".data forKey:@"abc1".data error:nil];
+	[_rocks setData:@"abc3".data forKey:@"abc3".data error:nil];
+	[_rocks setData:@"abc2".data forKey:@"abc2".data error:nil];
+
+	NSArray *expected = @[@"abc3".data, @"abc2".data, @"abc1".data];
+	XCTAssertEqualObjects([self allKeys], expected);
+	XCTAssertGreaterThan(calls, 0);
+}
+
+- (NSArray<NSData *> *)allKeys
+{
+	NSMutableArray *keys = [NSMutableArray array];
+	RocksDBIterator *iterator = [_rocks iterator];
+	[iterator enumerateKeysUsingBlock:^(NSData *key, BOOL *stop) {
+		[keys addObject:key];
+	}];
+	[iterator close];
+	return keys;
+}
+
+- (void)assertComparatorType:(RocksDBComparatorType)type ordersKeys:(NSArray<NSData *> *)expected
+{
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.comparator = [RocksDBComparator comaparatorWithType:type];
+	}];
+
+	for (NSData *key in expected.reverseObjectEnumerator) {
+		[_rocks setData:key forKey:key error:nil];
+	}
+
+	XCTAssertEqualObjects([self allKeys], expected);
+}
+
+- (void)testComparator_Native_UTF8CodePoint
+{
+	[self assertComparatorType:RocksDBComparatorUTF8CodePoint
+					ordersKeys:@[@"A".data, @"a".data, @"z".data, @"é".data, @"中".data, @"𝄞".data]];
+}
+
+- (void)testComparator_Native_UInt64BigEndian
+{
+	[self assertComparatorType:RocksDBComparatorUInt64BigEndian
+					ordersKeys:@[BigEndianData(0), BigEndianData(1), BigEndianData(256), BigEndianData(300), BigEndianData(UINT64_MAX)]];
+}
+
+- (void)testComparator_Native_Int64BigEndian
+{
+	[self assertComparatorType:RocksDBComparatorInt64BigEndian
+					ordersKeys:@[BigEndianData((uint64_t)INT64_MIN), BigEndianData((uint64_t)-300), BigEndianData((uint64_t)-5),
+								 BigEndianData(0), BigEndianData(3), BigEndianData(INT64_MAX)]];
+}
+
+- (void)testComparator_Native_DoubleBigEndian
+{
+	[self assertComparatorType:RocksDBComparatorDoubleBigEndian
+					ordersKeys:@[BigEndianDoubleData(-INFINITY), BigEndianDoubleData(-1.5), BigEndianDoubleData(-0.0),
+								 BigEndianDoubleData(0.0), BigEndianDoubleData(1e-10), BigEndianDoubleData(2.25),
+								 BigEndianDoubleData(INFINITY)]];
+}
+
+- (void)testComparator_Native_LengthPrefixed
+{
+	NSData *a = [RocksDBComparator lengthPrefixedKeyWithComponents:@[@"a".data]];
+	NSData *az = [RocksDBComparator lengthPrefixedKeyWithComponents:@[@"a".data, @"z".data]];
+	NSData *ab = [RocksDBComparator lengthPrefixedKeyWithComponents:@[@"ab".data]];
+	NSData *b = [RocksDBComparator lengthPrefixedKeyWithComponents:@[@"b".data]];
+
+	[self assertComparatorType:RocksDBComparatorLengthPrefixed ordersKeys:@[a, az, ab, b]];
+}
+
+- (void)testComparator_SeparatorAndSuccessorBlocks
+{
+	RocksDBComparator *comparator = [[RocksDBComparator alloc] initWithName:@"comparator"
+															comparatorBlock:^int(NSData *key1, NSData *key2) {
+																return BytewiseCompare(key1, key2);
+															} separatorBlock:^NSData *(NSData *start, NSData *limit) {
+																// Invalid separator, must be ignored
+																return limit;
+															} successorBlock:^NSData *(NSData *key) {
+																// Invalid successor, must be ignored
+																return [NSData data];
+															}];
+
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.comparator = comparator;
+		options.tableFacotry = [RocksDBTableFactory blockBasedTableFactoryWithOptions:^(RocksDBBlockBasedTableOptions *options) {
+			options.blockSize = 256;
+		}];
+	}];
+
+	NSMutableArray *expected = [NSMutableArray array];
+	for (int i = 0; i < 1000; i++) {
+		NSData *key = [NSString stringWithFormat:@"key %04d", i].data;
+		[expected addObject:key];
+		[_rocks setData:key forKey:key error:nil];
+	}
+
+	[_rocks compactRange:RocksDBOpenRange withOptions:nil error:nil];
+
+	XCTAssertEqualObjects([self allKeys], expected);
+	for (NSData *key in expected) {
+		XCTAssertEqualObjects([_rocks dataForKey:key error:nil], key);
+	}
+}
+
+#if !(defined(ROCKSDB_LITE) && defined(TARGET_OS_IPHONE))
+
+- (RocksDB *)populatedDatabaseWithComparator:(RocksDBComparator *)comparator
+{
+	RocksDB *db = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.comparator = comparator;
+		options.tableFacotry = [RocksDBTableFactory blockBasedTableFactoryWithOptions:^(RocksDBBlockBasedTableOptions *options) {
+			options.blockSize = 1024;
+		}];
+	}];
+
+	for (int i = 0; i < 10000; i++) {
+		[db setData:@"value".data forKey:GappedKeyForIndex(i) error:nil];
+	}
+
+	[db compactRange:RocksDBOpenRange withOptions:nil error:nil];
+	return db;
+}
+
+- (uint64_t)indexSizeWithComparator:(RocksDBComparator *)comparator
+{
+	RocksDB *db = [self populatedDatabaseWithComparator:comparator];
+	uint64_t size = [db valueForIntProperty:RocksDBIntPropertyEstimatedUsageByTableReaders];
+
+	[db close];
+	[[NSFileManager defaultManager] removeItemAtPath:_path error:nil];
+
+	return size;
+}
+
+- (void)testComparator_SeparatorAndSuccessorBlocks_IndexSize
+{
+	RocksDBComparator *plain = [[RocksDBComparator alloc] initWithName:@"comparator" andBlock:^int(NSData *key1, NSData *key2) {
+		return BytewiseCompare(key1, key2);
+	}];
+
+	__block NSUInteger shortenedSeparators = 0;
+	RocksDBComparator *shortening = [[RocksDBComparator alloc] initWithName:@"comparator"
+															comparatorBlock:^int(NSData *key1, NSData *key2) {
+																return BytewiseCompare(key1, key2);
+															} separatorBlock:^NSData *(NSData *start, NSData *limit) {
+																const uint8_t *startBytes = (const uint8_t *)start.bytes;
+																const uint8_t *limitBytes = (const uint8_t *)limit.bytes;
+																NSUInteger length = MIN(start.length, limit.length);
+																NSUInteger idx = 0;
+																while (idx < length && startBytes[idx] == limitBytes[idx]) {
+																	idx++;
+																}
+																if (idx >= length || startBytes[idx] == 0xff || startBytes[idx] + 1 >= limitBytes[idx]) {
+																	return nil;
+																}
+																NSMutableData *separator = [[start subdataWithRange:NSMakeRange(0, idx + 1)] mutableCopy];
+																((uint8_t *)separator.mutableBytes)[idx]++;
+																shortenedSeparators++;
+																return separator;
+															} successorBlock:^NSData *(NSData *key) {
+																const uint8_t *bytes = (const uint8_t *)key.bytes;
+																for (NSUInteger idx = 0; idx < key.length; idx++) {
+																	if (bytes[idx] != 0xff) {
+																		NSMutableData *successor = [[key subdataWithRange:NSMakeRange(0, idx + 1)] mutableCopy];
+																		((uint8_t *)successor.mutableBytes)[idx]++;
+																		return successor;
+																	}
+																}
+																return nil;
+															}];
+
+	uint64_t plainSize = [self indexSizeWithComparator:plain];
+	uint64_t shorteningSize = [self indexSizeWithComparator:shortening];
+
+	XCTAssertGreaterThan(shortenedSeparators, 0);
+	XCTAssertGreaterThan(plainSize, 0);
+	XCTAssertLessThan(shorteningSize, plainSize);
+}
+
+- (void)testComparator_SeparatorBlock_InvalidSeparatorIsIgnored
+{
+	__block NSUInteger separatorCalls = 0;
+
+	// "~" sorts after all keys, i.e. it is not less than the limit and would corrupt the index
+	RocksDBComparator *comparator = [[RocksDBComparator alloc] initWithName:@"comparator"
+															comparatorBlock:^int(NSData *key1, NSData *key2) {
+																return BytewiseCompare(key1, key2);
+															} separatorBlock:^NSData *(NSData *start, NSData *limit) {
+																separatorCalls++;
+																return @"~".data;
+															} successorBlock:nil];
+
+	_rocks = [self populatedDatabaseWithComparator:comparator];
+
+	XCTAssertGreaterThan(separatorCalls, 0);
+	for (int i = 0; i < 10000; i += 97) {
+		XCTAssertEqualObjects([_rocks dataForKey:GappedKeyForIndex(i) error:nil], @"value".data);
+	}
+
+	NSMutableArray *keys = [NSMutableArray array];
+	RocksDBIterator *iterator = [_rocks iterator];
+	[iterator enumerateKeysUsingBlock:^(NSData *key, BOOL *stop) {
+		[keys addObject:key];
+	}];
+	[iterator close];
+
+	XCTAssertEqual(keys.count, 10000);
+	XCTAssertEqualObjects(keys.lastObject, GappedKeyForIndex(9999));
+}
+
+#endif
+
+#pragma mark - Performance
+
+- (void)measureInsertsWithComparatorType:(RocksDBComparatorType)type keys:(NSArray<NSData *> *)keys
+{
+	RocksDBComparator *comparator = [RocksDBComparator comaparatorWithType:type];
+
+	[self measureBlock:^{
+		[[NSFileManager defaultManager] removeItemAtPath:_path error:nil];
+
+		RocksDB *db = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+			options.createIfMissing = YES;
+			options.comparator = comparator;
+			options.writeBufferSize = 64 * 1024 * 1024;
+		}];
+
+		for (NSData *key in keys) {
+			[db setData:key forKey:key error:nil];
+		}
+
+		[db close];
+	}];
+}
+
+- (NSArray<NSData *> *)stringKeys
+{
+	NSMutableArray *keys = [NSMutableArray array];
+	for (uint32_t i = 0; i < 10000; i++) {
+		[keys addObject:[NSString stringWithFormat:@"key %u", arc4random()].data];
+	}
+	return keys;
+}
+
+- (NSArray<NSData *> *)fixedWidthKeys
+{
+	NSMutableArray *keys = [NSMutableArray array];
+	for (uint32_t i = 0; i < 10000; i++) {
+		[keys addObject:BigEndianData(((uint64_t)arc4random() << 32) | arc4random())];
+	}
+	return keys;
+}
+
+- (void)testPerformance_Comparator_Bytewise
+{
+	[self measureInsertsWithComparatorType:RocksDBComparatorBytewiseAscending keys:[self stringKeys]];
+}
+
+- (void)testPerformance_Comparator_StringCompare
+{
+	[self measureInsertsWithComparatorType:RocksDBComparatorStringCompareAscending keys:[self stringKeys]];
+}
+
+- (void)testPerformance_Comparator_UTF8CodePoint
+{
+	[self measureInsertsWithComparatorType:RocksDBComparatorUTF8CodePoint keys:[self stringKeys]];
+}
+
+- (void)testPerformance_Comparator_UInt64BigEndian
+{
+	[self measureInsertsWithComparatorType:RocksDBComparatorUInt64BigEndian keys:[self fixedWidthKeys]];
+}
+
+- (void)testPerformance_Comparator_Int64BigEndian
+{
+	[self measureInsertsWithComparatorType:RocksDBComparatorInt64BigEndian keys:[self fixedWidthKeys]];
+}
+
+- (void)testPerformance_Comparator_DoubleBigEndian
+{
+	[self measureInsertsWithComparatorType:RocksDBComparatorDoubleBigEndian keys:[self fixedWidthKeys]];
+}
+
+- (void)testPerformance_Comparator_LengthPrefixed
+{
+	NSMutableArray *keys = [NSMutableArray array];
+	for (NSData *key in [self stringKeys]) {
+		[keys addObject:[RocksDBComparator lengthPrefixedKeyWithComponents:@[@"prefix".data, key]]];
+	}
+	[self measureInsertsWithComparatorType:RocksDBComparatorLengthPrefixed keys:keys];
+}
+
 @end
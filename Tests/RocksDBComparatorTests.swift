@@ -164,4 +164,110 @@ class RocksDBComparatorTests : RocksDBTests {
 			idx -= 1
 		}
 	}
+
+	func allKeys() -> [Data] {
+		var keys = [Data]()
+		let iterator = rocks.iterator()
+		iterator.enumerateKeys { (key, stop) -> Void in
+			keys.append(key)
+		}
+		iterator.close()
+		return keys
+	}
+
+	func assertComparator(_ type: RocksDBComparatorType, orders expected: [Data]) {
+		rocks = RocksDB.database(atPath: self.path, andDBOptions: { (options) -> Void in
+			options.createIfMissing = true
+			options.comparator = RocksDBComparator.comaparator(with: type)
+		})
+
+		for key in expected.reversed() {
+			try! rocks.setData(key, forKey: key)
+		}
+
+		XCTAssertEqual(allKeys(), expected)
+	}
+
+	func testSwift_Comparator_SeparatorAndSuccessorBlocks() {
+		let comparator = RocksDBComparator(name: "comparator", comparator: { (key1, key2) -> Int32 in
+			return key1.lexicographicallyPrecedes(key2) ? -1 : (key1 == key2 ? 0 : 1)
+		}, separator: { (start, limit) -> Data? in
+			// Invalid separator, must be ignored
+			return limit
+		}, successor: { (key) -> Data? in
+			// Invalid successor, must be ignored
+			return Data()
+		})
+
+		rocks = RocksDB.database(atPath: self.path, andDBOptions: { (options) -> Void in
+			options.createIfMissing = true
+			options.comparator = comparator
+			options.tableFacotry = RocksDBTableFactory.blockBasedTableFactory(options: { (options) -> Void in
+				options.blockSize = 256
+			})
+		})
+
+		var expected = [Data]()
+		for i in 0..<1000 {
+			let key = String(format: "key %04d", i).data
+			expected.append(key)
+			try! rocks.setData(key, forKey: key)
+		}
+
+		try! rocks.compactRange(RocksDBOpenRange, withOptions: nil)
+
+		XCTAssertEqual(allKeys(), expected)
+		for key in expected {
+			XCTAssertEqual(try! rocks.data(forKey: key), key)
+		}
+	}
+
+	func testSwift_Comparator_CompareFunction() {
+		let compare: RocksDBCompareFunction = { (context, key1, length1, key2, length2) -> Int32 in
+			let result = memcmp(key1, key2, min(length1, length2))
+			if result != 0 {
+				return -result
+			}
+			return length1 < length2 ? 1 : (length1 > length2 ? -1 : 0)
+		}
+
+		rocks = RocksDB.database(atPath: self.path, andDBOptions: { (options) -> Void in
+			options.createIfMissing = true
+			options.comparator = RocksDBComparator(name: "reverse", context: nil, compareFunction: compare)
+		})
+
+		try! rocks.setData("abc1", forKey: "abc1")
+		try! rocks.setData("abc3", forKey: "abc3")
+		try! rocks.setData("abc2", forKey: "abc2")
+
+		XCTAssertEqual(allKeys(), ["abc3", "abc2", "abc1"])
+	}
+
+	func testSwift_Comparator_Native_UTF8CodePoint() {
+		assertComparator(.utf8CodePoint, orders: ["A", "a", "z", "é", "中", "𝄞"])
+	}
+
+	func testSwift_Comparator_Native_UInt64BigEndian() {
+		let values: [UInt64] = [0, 1, 256, 300, UInt64.max]
+		assertComparator(.uInt64BigEndian, orders: values.map { $0.bigEndian.data })
+	}
+
+	func testSwift_Comparator_Native_Int64BigEndian() {
+		let values: [Int64] = [Int64.min, -300, -5, 0, 3, Int64.max]
+		assertComparator(.int64BigEndian, orders: values.map { UInt64(bitPattern: $0).bigEndian.data })
+	}
+
+	func testSwift_Comparator_Native_DoubleBigEndian() {
+		let values: [Double] = [-Double.infinity, -1.5, -0.0, 0.0, 1e-10, 2.25, Double.infinity]
+		assertComparator(.doubleBigEndian, orders: values.map { $0.bitPattern.bigEndian.data })
+	}
+
+	func testSwift_Comparator_Native_LengthPrefixed() {
+		let a = RocksDBComparator.lengthPrefixedKey(withComponents: ["a"])
+		let az = RocksDBComparator.lengthPrefixedKey(withComponents: ["a", "z"])
+		let ab = RocksDBComparator.lengthPrefixedKey(withComponents: ["ab"])
+		let b = RocksDBComparator.lengthPrefixedKey(withComponents: ["b"])
+
+		assertComparator(.lengthPrefixed, orders: [a, az, ab, b])
+	}
 }
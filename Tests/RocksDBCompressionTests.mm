@@ -0,0 +1,152 @@
+//
+//  RocksDBCompressionTests.mm
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#import "RocksDBTests.h"
+
+static const int kNumberOfKeys = 100000;
+
+static NSData * KeyForIndex(int idx)
+{
+	return [NSString stringWithFormat:@"key:%08d", idx].data;
+}
+
+static NSData * PrefixedKeyForIndex(int idx)
+{
+	// Keys sharing a long prefix, which the block format delta-encodes
+	NSString *prefix = [@"tenant:" stringByPaddingToLength:128 withString:@"0" startingAtIndex:0];
+	return [NSString stringWithFormat:@"%@:key:%08d", prefix, idx].data;
+}
+
+static NSData * ValueForIndex(int idx)
+{
+	return [NSString stringWithFormat:@"{\"id\":%d,\"name\":\"user %d\",\"active\":true,\"tags\":[\"a\",\"b\",\"c\"]}", idx, idx % 100].data;
+}
+
+@interface RocksDBCompressionTests : RocksDBTests
+@end
+
+@implementation RocksDBCompressionTests
+
+- (void)testCompression_Options
+{
+	RocksDBCompressionOptions *compressionOptions = [RocksDBCompressionOptions new];
+	compressionOptions.level = 3;
+
+	RocksDBCompressionOptions *bottommostCompressionOptions = [RocksDBCompressionOptions new];
+	bottommostCompressionOptions.level = 19;
+	bottommostCompressionOptions.maxDictBytes = 16 * 1024;
+	bottommostCompressionOptions.zstdMaxTrainBytes = 100 * 16 * 1024;
+	bottommostCompressionOptions.enabled = YES;
+
+	RocksDBOptions *options = [RocksDBOptions new];
+	options.compressionPerLevel = @[@(RocksDBCompressionNone), @(RocksDBCompressionNone), @(RocksDBCompressionLZ4)];
+	options.compressionOptions = compressionOptions;
+	options.bottommostCompressionType = RocksDBCompressionZSTD;
+	options.bottommostCompressionOptions = bottommostCompressionOptions;
+	options.maxSubcompactions = 4;
+
+	NSArray *expected = @[@(RocksDBCompressionNone), @(RocksDBCompressionNone), @(RocksDBCompressionLZ4)];
+	XCTAssertEqualObjects(options.compressionPerLevel, expected);
+	XCTAssertEqual(options.compressionOptions.level, 3);
+	XCTAssertEqual(options.bottommostCompressionType, RocksDBCompressionZSTD);
+	XCTAssertEqual(options.bottommostCompressionOptions.maxDictBytes, 16 * 1024);
+	XCTAssertEqual(options.bottommostCompressionOptions.zstdMaxTrainBytes, 100 * 16 * 1024);
+	XCTAssertTrue(options.bottommostCompressionOptions.enabled);
+	XCTAssertEqual(options.maxSubcompactions, 4);
+
+	options.compressionPerLevel = @[];
+	XCTAssertEqual(options.compressionPerLevel.count, 0);
+}
+
+- (void)testCompression_Defaults
+{
+	RocksDBOptions *options = [RocksDBOptions new];
+	XCTAssertEqual(options.compressionPerLevel.count, 0);
+	XCTAssertEqual(options.bottommostCompressionType, RocksDBCompressionDisabled);
+	XCTAssertNil(options.bottommostCompressionOptions);
+	XCTAssertEqual(options.maxSubcompactions, 1);
+}
+
+- (void)testCompression_CompressionRatioPerLevel
+{
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.numLevels = 3;
+		// The default compression type is the best one linked into the build
+		options.bottommostCompressionType = options.compressionType;
+		options.compressionPerLevel = @[@(RocksDBCompressionNone), @(RocksDBCompressionNone), @(options.compressionType)];
+
+		RocksDBCompressionOptions *bottommostCompressionOptions = [RocksDBCompressionOptions new];
+		bottommostCompressionOptions.maxDictBytes = 16 * 1024;
+		bottommostCompressionOptions.enabled = YES;
+		options.bottommostCompressionOptions = bottommostCompressionOptions;
+	}];
+	XCTAssertNotNil(_rocks);
+
+	for (int i = 0; i < 10000; i++) {
+		[_rocks setData:ValueForIndex(i) forKey:PrefixedKeyForIndex(i) error:nil];
+	}
+
+	RocksDBColumnFamilyMetaData *metadata = [_rocks columnFamilyMetaData];
+	XCTAssertEqual(metadata.levels.count, 3);
+	for (RocksDBLevelFileMetaData *level in metadata.levels) {
+		XCTAssertEqual(level.compressionRatio, -1.0);
+	}
+
+	[_rocks compactRange:RocksDBOpenRange withOptions:nil error:nil];
+
+	// The compaction output is the bottommost level, thus it's written with the bottommost compression.
+	// Even without any compression algorithm in the build, the delta-encoded keys take less space than the raw data.
+	metadata = [_rocks columnFamilyMetaData];
+	NSUInteger compressedLevels = 0;
+	for (RocksDBLevelFileMetaData *level in metadata.levels) {
+		if (level.files.count == 0) {
+			XCTAssertEqual(level.compressionRatio, -1.0);
+		} else {
+			XCTAssertGreaterThan(level.compressionRatio, 1.0);
+			compressedLevels++;
+		}
+	}
+	XCTAssertEqual(compressedLevels, 1);
+
+	XCTAssertEqualObjects([_rocks dataForKey:PrefixedKeyForIndex(4242) error:nil], ValueForIndex(4242));
+}
+
+#pragma mark - Performance
+
+- (void)measureCompactionWithMaxSubcompactions:(uint32_t)maxSubcompactions
+{
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.disableAutoCompactions = YES;
+		options.maxSubcompactions = maxSubcompactions;
+
+		RocksDBCompressionOptions *compressionOptions = [RocksDBCompressionOptions new];
+		compressionOptions.maxDictBytes = 16 * 1024;
+		options.compressionOptions = compressionOptions;
+	}];
+
+	[self measureBlock:^{
+		for (int i = 0; i < kNumberOfKeys; i++) {
+			[_rocks setData:ValueForIndex(i) forKey:KeyForIndex(i) error:nil];
+		}
+		[_rocks compactRange:RocksDBOpenRange withOptions:nil error:nil];
+	}];
+}
+
+- (void)testPerformance_Compression_Compaction
+{
+	[self measureCompactionWithMaxSubcompactions:1];
+}
+
+- (void)testPerformance_Compression_Compaction_Subcompactions
+{
+	[self measureCompactionWithMaxSubcompactions:4];
+}
+
+@end
@@ -0,0 +1,47 @@
+//
+//  RocksDBCompressionTests.swift
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+import XCTest
+import ObjectiveRocks
+
+class RocksDBCompressionTests : RocksDBTests {
+
+	func testSwift_Compression_CompressionRatioPerLevel() {
+		rocks = RocksDB.database(atPath: self.path, andDBOptions: { (options) -> Void in
+			options.createIfMissing = true
+			options.numLevels = 3
+			options.compressionPerLevel = [NSNumber(value: RocksDBCompressionType.none.rawValue),
+										   NSNumber(value: RocksDBCompressionType.none.rawValue),
+										   NSNumber(value: options.compressionType.rawValue)]
+
+			let bottommostCompressionOptions = RocksDBCompressionOptions()
+			bottommostCompressionOptions.maxDictBytes = 16 * 1024
+			bottommostCompressionOptions.enabled = true
+			options.bottommostCompressionType = options.compressionType
+			options.bottommostCompressionOptions = bottommostCompressionOptions
+		})
+
+		// Keys sharing a long prefix, which the block format delta-encodes
+		let prefix = String(repeating: "0", count: 128)
+		for i in 0..<1000 {
+			try! rocks.setData("value \(i % 10)", forKey: "\(prefix):key \(i)")
+		}
+		try! rocks.compactRange(RocksDBOpenRange, withOptions: nil)
+
+		let levels = rocks.columnFamilyMetaData().levels
+		XCTAssertEqual(levels.count, 3)
+		for level in levels {
+			if level.files.isEmpty {
+				XCTAssertEqual(level.compressionRatio, -1.0)
+			} else {
+				XCTAssertGreaterThan(level.compressionRatio, 1.0)
+			}
+		}
+		XCTAssertEqual(levels.filter { !$0.files.isEmpty }.count, 1)
+	}
+}
@@ -0,0 +1,108 @@
+//
+//  RocksDBEventListenerTests.mm
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#import "RocksDBTests.h"
+
+@interface RocksDBEventListenerTests : RocksDBTests
+@end
+
+@implementation RocksDBEventListenerTests
+
+- (void)writeAndCompactKeys
+{
+	for (int i = 0; i < 100; i++) {
+		NSString *str = [NSString stringWithFormat:@"a%d", i];
+		[_rocks setData:str.data forKey:str.data error:nil];
+	}
+	[_rocks compactRange:RocksDBOpenRange withOptions:nil error:nil];
+}
+
+- (void)testEventListener_Flush
+{
+	// Later events may arrive after the wait has ended, thus only the first one fulfills an expectation
+	__block XCTestExpectation *flushed = [self expectationWithDescription:@"flush completed"];
+	__block XCTestExpectation *created = [self expectationWithDescription:@"table file created"];
+
+	RocksDBEventListener *listener = [RocksDBEventListener new];
+	listener.flushCompletedBlock = ^(RocksDBFlushJobInfo *info) {
+		XCTAssertEqualObjects(info.columnFamilyName, @"default");
+		XCTAssertGreaterThan(info.filePath.length, 0);
+		XCTAssertEqual(info.numberOfEntries, 100);
+		[flushed fulfill];
+		flushed = nil;
+	};
+	listener.tableFileCreatedBlock = ^(RocksDBTableFileCreationInfo *info) {
+		XCTAssertNil(info.error);
+		XCTAssertGreaterThan(info.fileSize, 0);
+		[created fulfill];
+		created = nil;
+	};
+
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.listeners = @[listener];
+	}];
+
+	[self writeAndCompactKeys];
+
+	[self waitForExpectationsWithTimeout:10 handler:nil];
+}
+
+- (void)testEventListener_Compaction
+{
+	__block XCTestExpectation *compacted = [self expectationWithDescription:@"compaction completed"];
+	__block XCTestExpectation *deleted = [self expectationWithDescription:@"table file deleted"];
+
+	dispatch_queue_t queue = dispatch_queue_create("test.listener", DISPATCH_QUEUE_SERIAL);
+	RocksDBEventListener *listener = [[RocksDBEventListener alloc] initWithQueue:queue];
+	__block uint64_t inputRecords = 0;
+	listener.compactionCompletedBlock = ^(RocksDBCompactionJobInfo *info) {
+		XCTAssertNil(info.error);
+		inputRecords += info.numberOfInputRecords;
+		if (inputRecords >= 200) {
+			XCTAssertGreaterThan(info.totalInputBytes, 0);
+			XCTAssertGreaterThan(info.totalOutputBytes, 0);
+			XCTAssertGreaterThan(info.inputFiles.count, 0);
+			XCTAssertGreaterThan(info.outputFiles.count, 0);
+			XCTAssertGreaterThanOrEqual(info.outputLevel, info.baseInputLevel);
+			[compacted fulfill];
+			compacted = nil;
+		}
+	};
+	listener.tableFileDeletedBlock = ^(RocksDBTableFileDeletionInfo *info) {
+		XCTAssertGreaterThan(info.filePath.length, 0);
+		[deleted fulfill];
+		deleted = nil;
+	};
+
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.listeners = @[listener];
+	}];
+
+	// The second round overlaps the first one, thus its compaction has to merge both
+	[self writeAndCompactKeys];
+	[self writeAndCompactKeys];
+
+	[self waitForExpectationsWithTimeout:10 handler:nil];
+}
+
+- (void)testEventListener_Options
+{
+	RocksDBEventListener *listener = [RocksDBEventListener new];
+
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.listeners = @[listener];
+		XCTAssertEqualObjects(options.listeners, @[listener]);
+	}];
+
+	XCTAssertNotNil(_rocks);
+}
+
+@end
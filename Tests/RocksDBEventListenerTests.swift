@@ -0,0 +1,36 @@
+//
+//  RocksDBEventListenerTests.swift
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+import XCTest
+import ObjectiveRocks
+
+class RocksDBEventListenerTests : RocksDBTests {
+
+	func testSwift_EventListener_Flush() {
+		var flushed: XCTestExpectation? = expectation(description: "flush completed")
+
+		let listener = RocksDBEventListener()
+		listener.flushCompletedBlock = { (info) in
+			XCTAssertEqual(info.columnFamilyName, "default")
+			XCTAssertEqual(info.numberOfEntries, UInt64(2))
+			flushed?.fulfill()
+			flushed = nil
+		}
+
+		rocks = RocksDB.database(atPath: self.path, andDBOptions: { (options) -> Void in
+			options.createIfMissing = true
+			options.listeners = [listener]
+		})
+
+		try! rocks.setData("value 1", forKey: "key 1")
+		try! rocks.setData("value 2", forKey: "key 2")
+		try! rocks.compactRange(RocksDBOpenRange, withOptions: nil)
+
+		waitForExpectations(timeout: 10, handler: nil)
+	}
+}
@@ -0,0 +1,143 @@
+//
+//  RocksDBFilterPolicyTests.mm
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#import "RocksDBTests.h"
+
+typedef NS_ENUM(NSUInteger, FilterKind)
+{
+	FilterKindBlockBased,
+	FilterKindFull,
+	FilterKindPartitioned
+};
+
+static const int kNumberOfKeys = 100000;
+static const int kNumberOfLookups = 10000;
+
+@interface RocksDBFilterPolicyTests : RocksDBTests
+{
+	RocksDBStatistics *_statistics;
+}
+@end
+
+@implementation RocksDBFilterPolicyTests
+
+- (void)openDatabaseWithFilterPolicy:(RocksDBFilterPolicy *)filterPolicy partitioned:(BOOL)partitioned
+{
+	_statistics = [RocksDBStatistics new];
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.statistics = _statistics;
+		options.tableFacotry = [RocksDBTableFactory blockBasedTableFactoryWithOptions:^(RocksDBBlockBasedTableOptions *options) {
+			options.blockCache = [RocksDBCache LRUCacheWithCapacity:64 * 1024 * 1024];
+			options.filterPolicy = filterPolicy;
+			if (partitioned) {
+				options.indexType = BlockBasedTableIndexTwoLevelIndexSearch;
+				options.partitionFilters = YES;
+				options.cacheIndexAndFilterBlocks = YES;
+			}
+		}];
+	}];
+
+	// Only even keys are written, so that the odd ones are absent but within the files' key ranges
+	for (int i = 0; i < kNumberOfKeys; i++) {
+		NSString *key = [NSString stringWithFormat:@"k%08d", i * 2];
+		[_rocks setData:key.data forKey:key.data error:nil];
+	}
+	[_rocks compactRange:RocksDBOpenRange withOptions:nil error:nil];
+}
+
+- (void)openDatabaseWithFilterKind:(FilterKind)kind
+{
+	RocksDBFilterPolicy *filterPolicy = [RocksDBFilterPolicy bloomFilterPolicyWithBitsPerKey:10
+																		useBlockBasedBuilder:kind == FilterKindBlockBased];
+	[self openDatabaseWithFilterPolicy:filterPolicy partitioned:kind == FilterKindPartitioned];
+}
+
+- (uint64_t)filterBlockSize
+{
+	NSString *tableProperties = [_rocks valueForProperty:RocksDBPropertyAggregatedTableProperties];
+	NSRegularExpression *regex = [NSRegularExpression regularExpressionWithPattern:@"filter block size=(\\d+)" options:0 error:nil];
+	NSTextCheckingResult *match = [regex firstMatchInString:tableProperties options:0 range:NSMakeRange(0, tableProperties.length)];
+	if (match == nil) {
+		return 0;
+	}
+	return [[tableProperties substringWithRange:[match rangeAtIndex:1]] longLongValue];
+}
+
+- (void)performNegativeLookups
+{
+	for (int i = 0; i < kNumberOfLookups; i++) {
+		NSString *key = [NSString stringWithFormat:@"k%08d", i * 20 + 1];
+		[_rocks dataForKey:key.data error:nil];
+	}
+}
+
+- (double)falsePositiveRate
+{
+	uint64_t useful = [_statistics countForTicker:RocksDBTickerBloomFilterUseful];
+	[self performNegativeLookups];
+	uint64_t avoided = [_statistics countForTicker:RocksDBTickerBloomFilterUseful] - useful;
+	return (double)(kNumberOfLookups - avoided) / kNumberOfLookups;
+}
+
+- (void)testFilterPolicy_FullFilterByDefault
+{
+	[self openDatabaseWithFilterPolicy:[RocksDBFilterPolicy bloomFilterPolicyWithBitsPerKey:10] partitioned:NO];
+	uint64_t defaultSize = [self filterBlockSize];
+	[_rocks close];
+	[[NSFileManager defaultManager] removeItemAtPath:_path error:nil];
+
+	[self openDatabaseWithFilterKind:FilterKindFull];
+	XCTAssertGreaterThan(defaultSize, 0);
+	XCTAssertEqual(defaultSize, [self filterBlockSize]);
+}
+
+- (void)testFilterPolicy_FalsePositiveRate
+{
+	for (FilterKind kind = FilterKindBlockBased; kind <= FilterKindPartitioned; kind++) {
+		[self openDatabaseWithFilterKind:kind];
+
+		XCTAssertGreaterThan([self filterBlockSize], 0);
+		// ~1% for 10 bits per key
+		XCTAssertLessThan([self falsePositiveRate], 0.05);
+
+		[_rocks close];
+		[[NSFileManager defaultManager] removeItemAtPath:_path error:nil];
+	}
+}
+
+#pragma mark - Performance
+
+- (void)measureNegativeLookupsWithFilterKind:(FilterKind)kind
+{
+	[self openDatabaseWithFilterKind:kind];
+
+	XCTAssertGreaterThan([self filterBlockSize], 0);
+	XCTAssertLessThan([self falsePositiveRate], 0.05);
+
+	[self measureBlock:^{
+		[self performNegativeLookups];
+	}];
+}
+
+- (void)testPerformance_FilterPolicy_NegativeLookups_BlockBased
+{
+	[self measureNegativeLookupsWithFilterKind:FilterKindBlockBased];
+}
+
+- (void)testPerformance_FilterPolicy_NegativeLookups_Full
+{
+	[self measureNegativeLookupsWithFilterKind:FilterKindFull];
+}
+
+- (void)testPerformance_FilterPolicy_NegativeLookups_Partitioned
+{
+	[self measureNegativeLookupsWithFilterKind:FilterKindPartitioned];
+}
+
+@end
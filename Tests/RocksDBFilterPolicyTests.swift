@@ -0,0 +1,32 @@
+//
+//  RocksDBFilterPolicyTests.swift
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+import XCTest
+import ObjectiveRocks
+
+class RocksDBFilterPolicyTests : RocksDBTests {
+
+	func testSwift_FilterPolicy_FullFilter() {
+		let statistics = RocksDBStatistics()
+
+		rocks = RocksDB.database(atPath: self.path, andDBOptions: { (options) -> Void in
+			options.createIfMissing = true
+			options.statistics = statistics
+			options.tableFacotry = RocksDBTableFactory.blockBasedTableFactory(options: { (options) -> Void in
+				options.filterPolicy = RocksDBFilterPolicy.bloomFilterPolicy(withBitsPerKey: 10)
+			})
+		})
+
+		try! rocks.setData("value 1", forKey: "key 1")
+		try! rocks.setData("value 3", forKey: "key 3")
+		try! rocks.compactRange(RocksDBOpenRange, withOptions: nil)
+
+		XCTAssertNil(try? rocks.data(forKey: "key 2"))
+		XCTAssertGreaterThan(statistics.count(for: RocksDBTicker.bloomFilterUseful), UInt64(0))
+	}
+}
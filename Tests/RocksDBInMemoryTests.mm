@@ -0,0 +1,122 @@
+//
+//  RocksDBInMemoryTests.mm
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#import "RocksDBTests.h"
+
+static const int kNumberOfKeys = 100000;
+
+static NSData * KeyForIndex(int idx)
+{
+	return [NSString stringWithFormat:@"%04d:%06d", idx % 1000, idx].data;
+}
+
+@interface RocksDBInMemoryTests : RocksDBTests
+@end
+
+@implementation RocksDBInMemoryTests
+
+- (void)testInMemory_MmapOptions
+{
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.allowMmapReads = YES;
+		options.allowMmapWrites = YES;
+
+		XCTAssertTrue(options.allowMmapReads);
+		XCTAssertTrue(options.allowMmapWrites);
+	}];
+	XCTAssertNotNil(_rocks);
+
+	[_rocks setData:@"value 1".data forKey:@"key 1".data error:nil];
+	[_rocks compactRange:RocksDBOpenRange withOptions:nil error:nil];
+
+	XCTAssertEqualObjects([_rocks dataForKey:@"key 1".data error:nil], @"value 1".data);
+}
+
+- (void)testInMemory_Profile
+{
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		[options optimizeForInMemoryLookupsWithPrefixExtractor:[RocksDBPrefixExtractor prefixExtractorWithType:RocksDBPrefixFixedLength
+																										 length:4]];
+		XCTAssertTrue(options.allowMmapReads);
+		XCTAssertEqual(options.maxOpenFiles, -1);
+		XCTAssertNotNil(options.prefixExtractor);
+		XCTAssertNotNil(options.tableFacotry);
+	}];
+	XCTAssertNotNil(_rocks);
+
+	for (int i = 0; i < 10000; i++) {
+		[_rocks setData:KeyForIndex(i) forKey:KeyForIndex(i) error:nil];
+	}
+	[_rocks compactRange:RocksDBOpenRange withOptions:nil error:nil];
+
+	XCTAssertEqualObjects([_rocks dataForKey:KeyForIndex(4242) error:nil], KeyForIndex(4242));
+	XCTAssertNil([_rocks dataForKey:@"0042:999999".data error:nil]);
+
+	NSMutableArray *keys = [NSMutableArray array];
+	RocksDBIterator *iterator = [_rocks iterator];
+	[iterator enumerateKeysWithPrefix:@"0042".data usingBlock:^(NSData *key, BOOL *stop) {
+		[keys addObject:key];
+	}];
+	[iterator close];
+
+	XCTAssertEqual(keys.count, 10);
+	XCTAssertEqualObjects(keys.firstObject, KeyForIndex(42));
+}
+
+#pragma mark - Performance
+
+- (void)measurePointLookups
+{
+	for (int i = 0; i < kNumberOfKeys; i++) {
+		[_rocks setData:KeyForIndex(i) forKey:KeyForIndex(i) error:nil];
+	}
+	[_rocks compactRange:RocksDBOpenRange withOptions:nil error:nil];
+
+	NSMutableArray<NSData *> *keys = [NSMutableArray arrayWithCapacity:kNumberOfKeys];
+	for (int i = 0; i < kNumberOfKeys; i++) {
+		[keys addObject:KeyForIndex((i * 7919) % kNumberOfKeys)];
+	}
+	// Page in the table files and fill the block cache
+	for (NSData *key in keys) {
+		[_rocks dataForKey:key error:nil];
+	}
+
+	[self measureBlock:^{
+		for (NSData *key in keys) {
+			[_rocks dataForKey:key error:nil];
+		}
+	}];
+}
+
+- (void)testPerformance_InMemory_BlockBasedTable
+{
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.maxOpenFiles = -1;
+		options.prefixExtractor = [RocksDBPrefixExtractor prefixExtractorWithType:RocksDBPrefixFixedLength length:4];
+		options.tableFacotry = [RocksDBTableFactory blockBasedTableFactoryWithOptions:^(RocksDBBlockBasedTableOptions *options) {
+			options.blockCache = [RocksDBCache LRUCacheWithCapacity:256 * 1024 * 1024];
+			options.filterPolicy = [RocksDBFilterPolicy bloomFilterPolicyWithBitsPerKey:10];
+		}];
+	}];
+	[self measurePointLookups];
+}
+
+- (void)testPerformance_InMemory_PlainTable
+{
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		[options optimizeForInMemoryLookupsWithPrefixExtractor:[RocksDBPrefixExtractor prefixExtractorWithType:RocksDBPrefixFixedLength
+																										 length:4]];
+	}];
+	[self measurePointLookups];
+}
+
+@end
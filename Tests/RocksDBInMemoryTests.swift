@@ -0,0 +1,28 @@
+//
+//  RocksDBInMemoryTests.swift
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+import XCTest
+import ObjectiveRocks
+
+class RocksDBInMemoryTests : RocksDBTests {
+
+	func testSwift_InMemory_Profile() {
+		rocks = RocksDB.database(atPath: self.path, andDBOptions: { (options) -> Void in
+			options.createIfMissing = true
+			options.optimizeForInMemoryLookups(with: RocksDBPrefixExtractor(type: .fixedLength, length: 3))
+			XCTAssertTrue(options.allowMmapReads)
+		})
+
+		try! rocks.setData("x", forKey: "100A")
+		try! rocks.setData("y", forKey: "101A")
+		try! rocks.compactRange(RocksDBOpenRange, withOptions: nil)
+
+		XCTAssertEqual(try! rocks.data(forKey: "100A"), "x".data)
+		XCTAssertEqual(try! rocks.data(forKey: "101A"), "y".data)
+	}
+}
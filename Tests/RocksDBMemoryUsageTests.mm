@@ -0,0 +1,76 @@
+//
+//  RocksDBMemoryUsageTests.mm
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#import "RocksDBTests.h"
+
+@interface RocksDBMemoryUsageTests : RocksDBTests
+@end
+
+@implementation RocksDBMemoryUsageTests
+
+- (RocksDB *)databaseAtPath:(NSString *)path withCache:(RocksDBCache *)cache
+{
+	return [RocksDB databaseAtPath:path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.tableFacotry = [RocksDBTableFactory blockBasedTableFactoryWithOptions:^(RocksDBBlockBasedTableOptions *options) {
+			options.blockCache = cache;
+		}];
+	}];
+}
+
+- (void)testMemoryUsage
+{
+	RocksDBCache *cache = [RocksDBCache LRUCacheWithCapacity:1024 * 1024];
+	_rocks = [self databaseAtPath:_path withCache:cache];
+
+	for (int i = 0; i < 100; i++) {
+		NSString *str = [NSString stringWithFormat:@"a%d", i];
+		[_rocks setData:str.data forKey:str.data error:nil];
+	}
+
+	RocksDBMemoryUsage *usage = [RocksDB approximateMemoryUsageForDatabases:@[_rocks] caches:@[cache]];
+	XCTAssertNotNil(usage);
+	XCTAssertGreaterThan(usage.memTableTotal, 0);
+	XCTAssertGreaterThan(usage.memTableUnflushed, 0);
+	XCTAssertGreaterThanOrEqual(usage.memTableTotal, usage.memTableUnflushed);
+
+	[_rocks compactRange:RocksDBOpenRange withOptions:nil error:nil];
+	for (int i = 0; i < 100; i++) {
+		NSString *str = [NSString stringWithFormat:@"a%d", i];
+		[_rocks dataForKey:str.data error:nil];
+	}
+
+	usage = [RocksDB approximateMemoryUsageForDatabases:@[_rocks] caches:@[cache]];
+	XCTAssertGreaterThan(usage.tableReadersTotal, 0);
+	XCTAssertGreaterThan(usage.cacheTotal, 0);
+	XCTAssertEqual([usage usageForCache:cache], usage.cacheTotal);
+	XCTAssertEqual([usage usageForCache:[RocksDBCache LRUCacheWithCapacity:1024]], 0);
+}
+
+- (void)testMemoryUsage_MultipleDatabases
+{
+	RocksDBCache *sharedCache = [RocksDBCache LRUCacheWithCapacity:1024 * 1024];
+	_rocks = [self databaseAtPath:_path withCache:sharedCache];
+	RocksDB *first = _rocks;
+	RocksDB *second = [self databaseAtPath:_backupPath withCache:sharedCache];
+
+	[first setData:@"value 1".data forKey:@"key 1".data error:nil];
+	[second setData:@"value 2".data forKey:@"key 2".data error:nil];
+
+	RocksDBMemoryUsage *firstUsage = [RocksDB approximateMemoryUsageForDatabases:@[first] caches:nil];
+	RocksDBMemoryUsage *totalUsage = [RocksDB approximateMemoryUsageForDatabases:@[first, second, first]
+																		  caches:@[sharedCache, sharedCache]];
+
+	XCTAssertGreaterThan(totalUsage.memTableUnflushed, firstUsage.memTableUnflushed);
+	XCTAssertEqual(firstUsage.cacheTotal, 0);
+	XCTAssertEqual(totalUsage.cacheTotal, [totalUsage usageForCache:sharedCache]);
+
+	[second close];
+}
+
+@end
@@ -0,0 +1,32 @@
+//
+//  RocksDBMemoryUsageTests.swift
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+import XCTest
+import ObjectiveRocks
+
+class RocksDBMemoryUsageTests : RocksDBTests {
+
+	func testSwift_MemoryUsage() {
+		let cache = RocksDBCache.lruCache(withCapacity: 1024 * 1024)
+
+		rocks = RocksDB.database(atPath: self.path, andDBOptions: { (options) -> Void in
+			options.createIfMissing = true
+			options.tableFacotry = RocksDBTableFactory.blockBasedTableFactory(options: { (options) -> Void in
+				options.blockCache = cache
+			})
+		})
+
+		try! rocks.setData("value 1", forKey: "key 1")
+		try! rocks.setData("value 2", forKey: "key 2")
+
+		let usage = RocksDB.approximateMemoryUsage(forDatabases: [rocks], caches: [cache])
+		XCTAssertNotNil(usage)
+		XCTAssertGreaterThan(usage!.memTableUnflushed, 0 as UInt64)
+		XCTAssertEqual(usage!.usage(for: cache), usage!.cacheTotal)
+	}
+}
@@ -44,6 +44,53 @@
 }
 @end
 
+#pragma mark - Functions
+
+static uint64_t DecodeUInt64(const char *data, size_t length)
+{
+	uint64_t value = 0;
+	if (length == sizeof(value)) {
+		memcpy(&value, data, sizeof(value));
+	}
+	return value;
+}
+
+static bool PartialMergeAddFunction(void *context, const char *key, size_t keyLength,
+									const char *left, size_t leftLength,
+									const char *right, size_t rightLength,
+									RocksDBMergeValue *newValue)
+{
+	uint64_t sum = DecodeUInt64(left, leftLength) + DecodeUInt64(right, rightLength);
+	RocksDBMergeValueAppend(newValue, (const char *)&sum, sizeof(sum));
+	return true;
+}
+
+static bool FullMergeAddFunction(void *context, const char *key, size_t keyLength,
+								 const char *existingValue, size_t existingLength,
+								 const RocksDBMergeOperands *operands,
+								 RocksDBMergeValue *newValue)
+{
+	uint64_t sum = existingValue ? DecodeUInt64(existingValue, existingLength) : 0;
+	for (size_t i = 0; i < RocksDBMergeOperandsCount(operands); i++) {
+		size_t length = 0;
+		const char *operand = RocksDBMergeOperandsGet(operands, i, &length);
+		sum += DecodeUInt64(operand, length);
+	}
+	RocksDBMergeValueAppend(newValue, (const char *)&sum, sizeof(sum));
+	return true;
+}
+
+static bool FullMergeOutOfBoundsFunction(void *context, const char *key, size_t keyLength,
+										 const char *existingValue, size_t existingLength,
+										 const RocksDBMergeOperands *operands,
+										 RocksDBMergeValue *newValue)
+{
+	size_t length = 42;
+	const char *operand = RocksDBMergeOperandsGet(operands, RocksDBMergeOperandsCount(operands), &length);
+	*(bool *)context = operand == NULL && length == 0;
+	return FullMergeAddFunction(context, key, keyLength, existingValue, existingLength, operands, newValue);
+}
+
 #pragma mark - Tests
 
 @interface RocksDBMergeOperatorTests : RocksDBTests
@@ -203,4 +250,274 @@
 	XCTAssertEqualObjects(actual, expected);
 }
 
+- (void)testMergeOperator_OperandList
+{
+	__block NSArray<NSData *> *copiedOperands = nil;
+
+	id partialMerge = ^NSData *(NSData * key, NSData *leftOperand, NSData *rightOperand) {
+		return nil;
+	};
+
+	id fullMerge = ^NSData *(NSData * key, NSData * _Nullable existingValue, NSArray<NSData *> *operandList) {
+		NSMutableString *result = existingValue ? [[NSMutableString alloc] initWithData:existingValue] : [NSMutableString string];
+		for (NSUInteger i = 0; i < operandList.count; i++) {
+			[result appendString:[[NSString alloc] initWithData:operandList[i]]];
+		}
+		copiedOperands = [operandList copy];
+		return result.data;
+	};
+
+	RocksDBMergeOperator *mergeOp = [RocksDBMergeOperator operatorWithName:@"operator"
+														 partialMergeBlock:partialMerge
+															fullMergeBlock:fullMerge];
+
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.mergeOperator = mergeOp;
+	}];
+
+	[_rocks setData:@"0".data forKey:@"Key".data error:nil];
+	for (int i = 1; i < 10; i++) {
+		[_rocks mergeData:[NSString stringWithFormat:@"%d", i].data forKey:@"Key".data error:nil];
+	}
+
+	NSString *actual = [[NSString alloc] initWithData:[_rocks dataForKey:@"Key".data error:nil]];
+	XCTAssertEqualObjects(actual, @"0123456789");
+
+	XCTAssertEqual(copiedOperands.count, 9);
+	XCTAssertEqualObjects(copiedOperands.firstObject, @"1".data);
+	XCTAssertEqualObjects(copiedOperands.lastObject, @"9".data);
+}
+
+- (void)testMergeOperator_OperandList_Lifetime
+{
+	__block NSData *retainedOperand = nil;
+	__block NSData *copiedOperand = nil;
+	__block BOOL reusesViews = NO;
+
+	id partialMerge = ^NSData *(NSData * key, NSData *leftOperand, NSData *rightOperand) {
+		return nil;
+	};
+
+	id fullMerge = ^NSData *(NSData * key, NSData * _Nullable existingValue, NSArray<NSData *> *operandList) {
+		retainedOperand = operandList.firstObject;
+		reusesViews = retainedOperand == operandList[0];
+		copiedOperand = [operandList.firstObject copy];
+		// The newest operand wins
+		return operandList.lastObject;
+	};
+
+	RocksDBMergeOperator *mergeOp = [RocksDBMergeOperator operatorWithName:@"operator"
+														 partialMergeBlock:partialMerge
+															fullMergeBlock:fullMerge];
+
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.mergeOperator = mergeOp;
+	}];
+
+	[_rocks mergeData:@"1".data forKey:@"Key".data error:nil];
+	[_rocks mergeData:@"2".data forKey:@"Key".data error:nil];
+
+	XCTAssertEqualObjects([_rocks dataForKey:@"Key".data error:nil], @"2".data);
+	XCTAssertTrue(reusesViews);
+	XCTAssertEqualObjects(copiedOperand, @"1".data);
+	// Operands don't outlive the merge block
+	XCTAssertEqual(retainedOperand.length, 0);
+}
+
+- (void)testMergeOperator_ShouldMerge
+{
+	__block NSUInteger shouldMergeCalls = 0;
+	__block BOOL fullMergeHadExistingValue = NO;
+
+	// Operands prefixed with "=" overwrite the value, so any older operands can be skipped
+	RocksDBMergeOperator *mergeOp = [RocksDBMergeOperator operatorWithName:@"operator"
+														 partialMergeBlock:^NSData * (NSData *key, NSData *leftOperand, NSData *rightOperand) {
+															 return nil;
+														 } fullMergeBlock:^NSData * (NSData *key, NSData *existingValue, NSArray<NSData *> *operandList) {
+															 fullMergeHadExistingValue = (existingValue != nil);
+															 NSMutableString *result = [NSMutableString new];
+															 if (existingValue != nil) {
+																 [result appendString:[[NSString alloc] initWithData:existingValue]];
+															 }
+															 for (NSData *operand in operandList) {
+																 NSString *str = [[NSString alloc] initWithData:operand];
+																 if ([str hasPrefix:@"="]) {
+																	 [result setString:[str substringFromIndex:1]];
+																 } else {
+																	 [result appendString:str];
+																 }
+															 }
+															 return result.data;
+														 } shouldMergeBlock:^BOOL (NSArray<NSData *> *operandList) {
+															 shouldMergeCalls++;
+															 NSString *newest = [[NSString alloc] initWithData:operandList.firstObject];
+															 return [newest hasPrefix:@"="];
+														 } allowSingleOperand:NO];
+
+	RocksDBStatistics *statistics = [RocksDBStatistics new];
+
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.mergeOperator = mergeOp;
+		options.statistics = statistics;
+	}];
+
+	[_rocks setData:@"0".data forKey:@"Key".data error:nil];
+	[_rocks mergeData:@"1".data forKey:@"Key".data error:nil];
+	[_rocks mergeData:@"=a".data forKey:@"Key".data error:nil];
+	[_rocks mergeData:@"b".data forKey:@"Key".data error:nil];
+	[_rocks mergeData:@"c".data forKey:@"Key".data error:nil];
+
+	NSString *actual = [[NSString alloc] initWithData:[_rocks dataForKey:@"Key".data error:nil]];
+	XCTAssertEqualObjects(actual, @"abc");
+	XCTAssertGreaterThan(shouldMergeCalls, 0);
+	XCTAssertFalse(fullMergeHadExistingValue);
+
+	RocksDBStatisticsHistogram *operands = [statistics histogramDataForType:RocksDBHistogramReadNumMergeOperands];
+	XCTAssertEqual(operands.average, 3.0);
+}
+
+- (void)testMergeOperator_AllowSingleOperand
+{
+	__block NSUInteger singleOperandCalls = 0;
+
+	// A single operand is normalized to upper case by the partial merge during compaction
+	RocksDBMergeOperator *mergeOp = [RocksDBMergeOperator operatorWithName:@"operator"
+														 partialMergeBlock:^NSData * (NSData *key, NSData *leftOperand, NSData *rightOperand) {
+															 if (leftOperand.length > 0) {
+																 return nil;
+															 }
+															 singleOperandCalls++;
+															 return [[[NSString alloc] initWithData:rightOperand] uppercaseString].data;
+														 } fullMergeBlock:^NSData * (NSData *key, NSData *existingValue, NSArray<NSData *> *operandList) {
+															 NSMutableString *result = [NSMutableString new];
+															 if (existingValue != nil) {
+																 [result appendString:[[NSString alloc] initWithData:existingValue]];
+															 }
+															 for (NSData *operand in operandList) {
+																 [result appendString:[[NSString alloc] initWithData:operand]];
+															 }
+															 return result.data;
+														 } shouldMergeBlock:nil
+														allowSingleOperand:YES];
+
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.mergeOperator = mergeOp;
+	}];
+
+	// Move the base value to the last level, so that compacting the upper levels sees the operand alone
+	[_rocks setData:@"a".data forKey:@"Key".data error:nil];
+	[_rocks compactRange:RocksDBOpenRange withOptions:^(RocksDBCompactRangeOptions *options) {
+		options.changeLevel = YES;
+		options.targetLevel = 6;
+	} error:nil];
+
+	[_rocks mergeData:@"b".data forKey:@"Key".data error:nil];
+	[_rocks compactRange:RocksDBOpenRange withOptions:nil error:nil];
+
+	XCTAssertGreaterThan(singleOperandCalls, 0);
+
+	NSString *actual = [[NSString alloc] initWithData:[_rocks dataForKey:@"Key".data error:nil]];
+	XCTAssertEqualObjects(actual, @"aB");
+}
+
+- (void)testMergeOperator_BuiltIn_UInt64Add
+{
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.mergeOperator = [RocksDBMergeOperator operatorWithType:RocksDBMergeOperatorUInt64Add];
+	}];
+
+	for (uint64_t i = 1; i <= 100; i++) {
+		[_rocks mergeData:[NSData dataWithBytes:&i length:sizeof(i)] forKey:@"Key".data error:nil];
+	}
+
+	uint64_t value = 0;
+	[[_rocks dataForKey:@"Key".data error:nil] getBytes:&value length:sizeof(value)];
+	XCTAssertEqual(value, 5050);
+
+	[_rocks compactRange:RocksDBOpenRange withOptions:nil error:nil];
+
+	value = 0;
+	[[_rocks dataForKey:@"Key".data error:nil] getBytes:&value length:sizeof(value)];
+	XCTAssertEqual(value, 5050);
+}
+
+- (void)testMergeOperator_BuiltIn_Max
+{
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.mergeOperator = [RocksDBMergeOperator operatorWithType:RocksDBMergeOperatorMax];
+	}];
+
+	[_rocks setData:@"c".data forKey:@"Key".data error:nil];
+	[_rocks mergeData:@"a".data forKey:@"Key".data error:nil];
+	[_rocks mergeData:@"e".data forKey:@"Key".data error:nil];
+	[_rocks mergeData:@"b".data forKey:@"Key".data error:nil];
+
+	XCTAssertEqualObjects([_rocks dataForKey:@"Key".data error:nil], @"e".data);
+}
+
+- (void)testMergeOperator_BuiltIn_Put
+{
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.mergeOperator = [RocksDBMergeOperator operatorWithType:RocksDBMergeOperatorPut];
+	}];
+
+	[_rocks setData:@"value 0".data forKey:@"Key".data error:nil];
+	[_rocks mergeData:@"value 1".data forKey:@"Key".data error:nil];
+	[_rocks mergeData:@"value 2".data forKey:@"Key".data error:nil];
+
+	XCTAssertEqualObjects([_rocks dataForKey:@"Key".data error:nil], @"value 2".data);
+}
+
+- (void)testMergeOperator_MergeFunctions
+{
+	RocksDBMergeOperator *mergeOp = [RocksDBMergeOperator operatorWithName:@"operator"
+																   context:NULL
+													  partialMergeFunction:&PartialMergeAddFunction
+														 fullMergeFunction:&FullMergeAddFunction];
+
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.mergeOperator = mergeOp;
+	}];
+
+	uint64_t initial = 100;
+	[_rocks setData:[NSData dataWithBytes:&initial length:sizeof(initial)] forKey:@"Key".data error:nil];
+	for (uint64_t i = 1; i <= 10; i++) {
+		[_rocks mergeData:[NSData dataWithBytes:&i length:sizeof(i)] forKey:@"Key".data error:nil];
+	}
+
+	uint64_t value = 0;
+	[[_rocks dataForKey:@"Key".data error:nil] getBytes:&value length:sizeof(value)];
+	XCTAssertEqual(value, 155);
+}
+
+- (void)testMergeOperator_MergeFunctions_OperandOutOfBounds
+{
+	bool outOfBoundsIsNull = false;
+	RocksDBMergeOperator *mergeOp = [RocksDBMergeOperator operatorWithName:@"operator"
+																   context:&outOfBoundsIsNull
+													  partialMergeFunction:NULL
+														 fullMergeFunction:&FullMergeOutOfBoundsFunction];
+
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.mergeOperator = mergeOp;
+	}];
+
+	uint64_t operand = 1;
+	[_rocks mergeData:[NSData dataWithBytes:&operand length:sizeof(operand)] forKey:@"Key".data error:nil];
+
+	uint64_t value = 0;
+	[[_rocks dataForKey:@"Key".data error:nil] getBytes:&value length:sizeof(value)];
+	XCTAssertEqual(value, 1);
+	XCTAssertTrue(outOfBoundsIsNull);
+}
+
 @end
@@ -28,6 +28,7 @@ extension DataConvertible {
 }
 
 extension Int : DataConvertible { }
+extension UInt64 : DataConvertible { }
 extension Double : DataConvertible { }
 
 extension Dictionary {
@@ -199,4 +200,183 @@ class RocksDBMergeOperatorTests : RocksDBTests {
 			XCTAssertEqual(value as! String, expected[key] as! String)
 		}
 	}
+
+	func testSwift_MergeOperator_OperandList() {
+
+		var copiedOperands: [Data] = []
+
+		let partial = { (key: Data, leftOperand: Data, rightOperand: Data) -> Data? in
+			return nil
+		}
+
+		let full = { (key: Data, existing: Data?, operands: [Data]) -> Data? in
+			var result = ""
+			if let existing = existing {
+				result = String(data: existing, encoding: .utf8)!
+			}
+			for op in operands {
+				result += String(data: op, encoding: .utf8)!
+			}
+			copiedOperands = operands
+			return result.data
+		}
+
+		let mergeOp = RocksDBMergeOperator(name: "operator", partialMerge: partial, fullMerge: full)
+
+		rocks = RocksDB.database(atPath: self.path, andDBOptions: { (options) -> Void in
+			options.createIfMissing = true
+			options.mergeOperator = mergeOp
+		})
+
+		try! rocks.setData("0", forKey: "key")
+		for i in 1..<10 {
+			try! rocks.merge(String(i).data, forKey: "key")
+		}
+
+		let data = try! rocks.data(forKey: "key")
+		XCTAssertEqual(String(data: data, encoding: .utf8), "0123456789")
+
+		XCTAssertEqual(copiedOperands.count, 9)
+		XCTAssertEqual(copiedOperands.first, "1")
+		XCTAssertEqual(copiedOperands.last, "9")
+	}
+
+	func testSwift_MergeOperator_ShouldMerge() {
+
+		var shouldMergeCalls = 0
+		var fullMergeHadExistingValue = false
+
+		let partial = { (key: Data, leftOperand: Data, rightOperand: Data) -> Data? in
+			return nil
+		}
+
+		// Operands prefixed with "=" overwrite the value, so any older operands can be skipped
+		let full = { (key: Data, existing: Data?, operands: [Data]) -> Data? in
+			fullMergeHadExistingValue = existing != nil
+			var result = ""
+			if let existing = existing {
+				result = String(data: existing, encoding: .utf8)!
+			}
+			for op in operands {
+				let str = String(data: op, encoding: .utf8)!
+				if str.hasPrefix("=") {
+					result = String(str.dropFirst())
+				} else {
+					result += str
+				}
+			}
+			return result.data
+		}
+
+		let shouldMerge = { (operands: [Data]) -> Bool in
+			shouldMergeCalls += 1
+			return String(data: operands.first!, encoding: .utf8)!.hasPrefix("=")
+		}
+
+		let mergeOp = RocksDBMergeOperator(name: "operator",
+		                                   partialMerge: partial,
+		                                   fullMerge: full,
+		                                   shouldMerge: shouldMerge,
+		                                   allowSingleOperand: false)
+
+		let statistics = RocksDBStatistics()
+
+		rocks = RocksDB.database(atPath: self.path, andDBOptions: { (options) -> Void in
+			options.createIfMissing = true
+			options.mergeOperator = mergeOp
+			options.statistics = statistics
+		})
+
+		try! rocks.setData("0", forKey: "key")
+		try! rocks.merge("1", forKey: "key")
+		try! rocks.merge("=a", forKey: "key")
+		try! rocks.merge("b", forKey: "key")
+		try! rocks.merge("c", forKey: "key")
+
+		let data = try! rocks.data(forKey: "key")
+		XCTAssertEqual(String(data: data, encoding: .utf8), "abc")
+		XCTAssertGreaterThan(shouldMergeCalls, 0)
+		XCTAssertFalse(fullMergeHadExistingValue)
+
+		let operands = statistics.histogramData(forType: RocksDBHistogram.readNumMergeOperands)
+		XCTAssertEqual(operands.average, 3.0)
+	}
+
+	func testSwift_MergeOperator_BuiltIn_UInt64Add() {
+		rocks = RocksDB.database(atPath: self.path, andDBOptions: { (options) -> Void in
+			options.createIfMissing = true
+			options.mergeOperator = RocksDBMergeOperator(type: .uInt64Add)
+		})
+
+		for i: UInt64 in 1...100 {
+			try! rocks.merge(i.data, forKey: "key")
+		}
+
+		let value = UInt64(data: try! rocks.data(forKey: "key"))
+		XCTAssertEqual(value, 5050)
+	}
+
+	func testSwift_MergeOperator_BuiltIn_Max() {
+		rocks = RocksDB.database(atPath: self.path, andDBOptions: { (options) -> Void in
+			options.createIfMissing = true
+			options.mergeOperator = RocksDBMergeOperator(type: .max)
+		})
+
+		try! rocks.setData("c", forKey: "key")
+		try! rocks.merge("a", forKey: "key")
+		try! rocks.merge("e", forKey: "key")
+		try! rocks.merge("b", forKey: "key")
+
+		XCTAssertEqual(try! rocks.data(forKey: "key"), "e")
+	}
+
+	func testSwift_MergeOperator_BuiltIn_Put() {
+		rocks = RocksDB.database(atPath: self.path, andDBOptions: { (options) -> Void in
+			options.createIfMissing = true
+			options.mergeOperator = RocksDBMergeOperator(type: .put)
+		})
+
+		try! rocks.setData("value 0", forKey: "key")
+		try! rocks.merge("value 1", forKey: "key")
+		try! rocks.merge("value 2", forKey: "key")
+
+		XCTAssertEqual(try! rocks.data(forKey: "key"), "value 2")
+	}
+
+	func testSwift_MergeOperator_MergeFunctions() {
+		let fullMerge: RocksDBFullMergeFunction = { (context, key, keyLength, existing, existingLength, operands, newValue) -> Bool in
+			var sum: UInt64 = 0
+			if let existing = existing, existingLength == MemoryLayout<UInt64>.size {
+				memcpy(&sum, existing, existingLength)
+			}
+			for i in 0..<RocksDBMergeOperandsCount(operands) {
+				var length = 0
+				let operand = RocksDBMergeOperandsGet(operands, i, &length)
+				var value: UInt64 = 0
+				if let operand = operand, length == MemoryLayout<UInt64>.size {
+					memcpy(&value, operand, length)
+				}
+				sum += value
+			}
+			withUnsafeBytes(of: &sum) { buffer in
+				RocksDBMergeValueAppend(newValue, buffer.baseAddress!.assumingMemoryBound(to: Int8.self), buffer.count)
+			}
+			return true
+		}
+
+		let mergeOp = RocksDBMergeOperator(name: "operator", context: nil, partialMergeFunction: nil, fullMergeFunction: fullMerge)
+
+		rocks = RocksDB.database(atPath: self.path, andDBOptions: { (options) -> Void in
+			options.createIfMissing = true
+			options.mergeOperator = mergeOp
+		})
+
+		try! rocks.setData(UInt64(100).data, forKey: "key")
+		for i: UInt64 in 1...10 {
+			try! rocks.merge(i.data, forKey: "key")
+		}
+
+		let value = UInt64(data: try! rocks.data(forKey: "key"))
+		XCTAssertEqual(value, 155)
+	}
 }
@@ -0,0 +1,180 @@
+//
+//  RocksDBMetricsExporterTests.mm
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#import "RocksDBTests.h"
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+@interface RocksDBMetricsExporterTests : RocksDBTests
+@end
+
+@implementation RocksDBMetricsExporterTests
+
+- (RocksDBStatistics *)openDatabaseWithColumnFamily
+{
+	RocksDBStatistics *statistics = [RocksDBStatistics new];
+
+	RocksDBColumnFamilyDescriptor *descriptor = [RocksDBColumnFamilyDescriptor new];
+	[descriptor addDefaultColumnFamilyWithOptions:nil];
+	[descriptor addColumnFamilyWithName:@"new_cf" andOptions:nil];
+
+	_rocks = [RocksDB databaseAtPath:_path columnFamilies:descriptor andDatabaseOptions:^(RocksDBDatabaseOptions *options) {
+		options.createIfMissing = YES;
+		options.createMissingColumnFamilies = YES;
+		options.statistics = statistics;
+	}];
+
+	for (int i = 0; i < 100; i++) {
+		NSString *str = [NSString stringWithFormat:@"a%d", i];
+		[_rocks.columnFamilies[1] setData:str.data forKey:str.data error:nil];
+	}
+	[_rocks.columnFamilies[1] compactRange:RocksDBOpenRange withOptions:nil error:nil];
+
+	return statistics;
+}
+
+- (void)testMetricsExporter_Text
+{
+	RocksDBStatistics *statistics = [self openDatabaseWithColumnFamily];
+	RocksDBMetricsExporter *exporter = [[RocksDBMetricsExporter alloc] initWithDatabase:_rocks statistics:statistics];
+
+	NSString *text = [exporter prometheusText];
+
+	XCTAssertTrue([text containsString:@"# TYPE rocksdb_bytes_written_total counter\n"]);
+	XCTAssertTrue([text containsString:@"# TYPE rocksdb_db_write_micros summary\n"]);
+	XCTAssertTrue([text containsString:@"rocksdb_db_write_micros{quantile=\"0.99\"} "]);
+	XCTAssertTrue([text containsString:@"# TYPE rocksdb_db_write_micros_max gauge\n"]);
+	XCTAssertTrue([text containsString:@"rocksdb_db_write_micros_count 100\n"]);
+	XCTAssertTrue([text containsString:@"rocksdb_num_immutable_mem_table{column_family=\"default\"} 0\n"]);
+	XCTAssertTrue([text containsString:@"rocksdb_estimate_num_keys{column_family=\"new_cf\"} 100\n"]);
+	XCTAssertTrue([text containsString:@"rocksdb_level_files{column_family=\"new_cf\",level=\"0\"} "]);
+	// The compaction moved all files out of L0, whose ratio is thus not exported
+	XCTAssertFalse([text containsString:@"rocksdb_level_compression_ratio{column_family=\"new_cf\",level=\"0\"}"]);
+	XCTAssertTrue([text containsString:@"rocksdb_level_compression_ratio{column_family=\"new_cf\",level=\"1\"} "]);
+
+	// The default column family is listed once, even though it is also in `columnFamilies`
+	NSArray *lines = [text componentsSeparatedByString:@"rocksdb_num_snapshots{column_family=\"default\"}"];
+	XCTAssertEqual(lines.count, 2);
+}
+
+- (double)valueOfMetric:(NSString *)metric inText:(NSString *)text
+{
+	for (NSString *line in [text componentsSeparatedByString:@"\n"]) {
+		if ([line hasPrefix:[metric stringByAppendingString:@" "]]) {
+			return [[line substringFromIndex:metric.length + 1] doubleValue];
+		}
+	}
+	return -1;
+}
+
+- (void)testMetricsExporter_HistogramQuantiles
+{
+	RocksDBStatistics *statistics = [self openDatabaseWithColumnFamily];
+	RocksDBMetricsExporter *exporter = [[RocksDBMetricsExporter alloc] initWithDatabase:_rocks statistics:statistics];
+
+	NSString *text = [exporter prometheusText];
+
+	// Each of the 100 writes records its size in bytes, thus all quantiles are non-zero
+	double median = [self valueOfMetric:@"rocksdb_bytes_per_write{quantile=\"0.5\"}" inText:text];
+	double p999 = [self valueOfMetric:@"rocksdb_bytes_per_write{quantile=\"0.999\"}" inText:text];
+	double max = [self valueOfMetric:@"rocksdb_bytes_per_write_max" inText:text];
+
+	XCTAssertGreaterThan(median, 0.0);
+	XCTAssertGreaterThanOrEqual(p999, median);
+	XCTAssertLessThanOrEqual(p999, max);
+	XCTAssertEqualWithAccuracy(p999, [statistics histogramDataForType:RocksDBHistogramBytesPerWrite].percentile999, 0.01);
+}
+
+- (void)testMetricsExporter_WithoutStatistics
+{
+	[self openDatabaseWithColumnFamily];
+	RocksDBMetricsExporter *exporter = [[RocksDBMetricsExporter alloc] initWithDatabase:_rocks statistics:nil];
+
+	NSString *text = [exporter prometheusText];
+
+	XCTAssertFalse([text containsString:@"rocksdb_bytes_written_total"]);
+	XCTAssertTrue([text containsString:@"rocksdb_level_size_bytes{column_family=\"new_cf\""]);
+}
+
+- (void)testMetricsExporter_ClosedDatabase
+{
+	RocksDBStatistics *statistics = [self openDatabaseWithColumnFamily];
+	RocksDBMetricsExporter *exporter = [[RocksDBMetricsExporter alloc] initWithDatabase:_rocks statistics:statistics];
+
+	NSError *error = nil;
+	NSString *file = [_path stringByAppendingPathComponent:@"metrics.prom"];
+	XCTAssertTrue([exporter startExportingToFileAtPath:file interval:0.01 error:&error]);
+	[NSThread sleepForTimeInterval:0.05];
+	[_rocks close];
+	[exporter stop];
+
+	NSString *text = [exporter prometheusText];
+
+	XCTAssertTrue([text containsString:@"rocksdb_bytes_written_total "]);
+	XCTAssertFalse([text containsString:@"column_family="]);
+}
+
+- (void)testMetricsExporter_File
+{
+	RocksDBStatistics *statistics = [self openDatabaseWithColumnFamily];
+	RocksDBMetricsExporter *exporter = [[RocksDBMetricsExporter alloc] initWithDatabase:_rocks statistics:statistics];
+
+	NSString *file = [_path stringByAppendingPathComponent:@"metrics.prom"];
+	NSError *error = nil;
+	XCTAssertTrue([exporter startExportingToFileAtPath:file interval:0.1 error:&error]);
+	XCTAssertNil(error);
+	XCTAssertTrue(exporter.isRunning);
+
+	NSDate *deadline = [NSDate dateWithTimeIntervalSinceNow:5];
+	while (![[NSFileManager defaultManager] fileExistsAtPath:file] && deadline.timeIntervalSinceNow > 0) {
+		[NSThread sleepForTimeInterval:0.05];
+	}
+	[exporter stop];
+	XCTAssertFalse(exporter.isRunning);
+
+	NSString *text = [NSString stringWithContentsOfFile:file encoding:NSUTF8StringEncoding error:nil];
+	XCTAssertTrue([text containsString:@"rocksdb_bytes_written_total "]);
+
+	XCTAssertFalse([exporter startExportingToFileAtPath:@"/nonexistent/metrics.prom" interval:1 error:&error]);
+	XCTAssertNotNil(error);
+}
+
+- (void)testMetricsExporter_Socket
+{
+	RocksDBStatistics *statistics = [self openDatabaseWithColumnFamily];
+	RocksDBMetricsExporter *exporter = [[RocksDBMetricsExporter alloc] initWithDatabase:_rocks statistics:statistics];
+
+	NSString *socketPath = [NSTemporaryDirectory() stringByAppendingPathComponent:@"ObjectiveRocks.metrics.sock"];
+	NSError *error = nil;
+	XCTAssertTrue([exporter startExportingToSocketAtPath:socketPath interval:0.1 error:&error]);
+	XCTAssertNil(error);
+
+	struct sockaddr_un address = {};
+	address.sun_family = AF_UNIX;
+	strncpy(address.sun_path, socketPath.fileSystemRepresentation, sizeof(address.sun_path) - 1);
+
+	int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+	XCTAssertEqual(connect(fd, (struct sockaddr *)&address, sizeof(address)), 0);
+
+	NSMutableData *data = [NSMutableData data];
+	char buffer[4096];
+	ssize_t length;
+	while ((length = read(fd, buffer, sizeof(buffer))) > 0) {
+		[data appendBytes:buffer length:length];
+	}
+	close(fd);
+
+	NSString *text = [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding];
+	XCTAssertTrue([text containsString:@"rocksdb_estimate_num_keys{column_family=\"new_cf\"} 100\n"]);
+
+	[exporter stop];
+}
+
+@end
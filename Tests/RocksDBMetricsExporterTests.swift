@@ -0,0 +1,33 @@
+//
+//  RocksDBMetricsExporterTests.swift
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+import XCTest
+import ObjectiveRocks
+
+class RocksDBMetricsExporterTests : RocksDBTests {
+
+	func testSwift_MetricsExporter_Text() {
+		let statistics = RocksDBStatistics()
+
+		rocks = RocksDB.database(atPath: self.path, andDBOptions: { (options) -> Void in
+			options.createIfMissing = true
+			options.statistics = statistics
+		})
+
+		try! rocks.setData("value 1", forKey: "key 1")
+		try! rocks.setData("value 2", forKey: "key 2")
+		try! rocks.compactRange(RocksDBOpenRange, withOptions: nil)
+
+		let exporter = RocksDBMetricsExporter(database: rocks, statistics: statistics)
+		let text = exporter.prometheusText()
+
+		XCTAssertTrue(text.contains("# TYPE rocksdb_bytes_written_total counter\n"))
+		XCTAssertTrue(text.contains("rocksdb_db_write_micros_count 2\n"))
+		XCTAssertTrue(text.contains("rocksdb_level_files{column_family=\"default\""))
+	}
+}
@@ -0,0 +1,79 @@
+//
+//  RocksDBPerfContextTests.mm
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#import "RocksDBTests.h"
+
+@interface RocksDBPerfContextTests : RocksDBTests
+@end
+
+@implementation RocksDBPerfContextTests
+
+- (void)testPerfContext_PerfLevel
+{
+	RocksDBPerfLevel previous = [RocksDBPerfContext perfLevel];
+
+	[RocksDBPerfContext setPerfLevel:RocksDBPerfLevelEnableCount];
+	XCTAssertEqual([RocksDBPerfContext perfLevel], RocksDBPerfLevelEnableCount);
+
+	[RocksDBPerfContext contextByMeasuringBlock:^{} withPerfLevel:RocksDBPerfLevelEnableTime];
+	XCTAssertEqual([RocksDBPerfContext perfLevel], RocksDBPerfLevelEnableCount);
+
+	[RocksDBPerfContext setPerfLevel:previous];
+}
+
+- (void)testPerfContext_Get
+{
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+	}];
+
+	for (int i = 0; i < 100; i++) {
+		NSString *str = [NSString stringWithFormat:@"a%d", i];
+		[_rocks setData:str.data forKey:str.data error:nil];
+	}
+	[_rocks compactRange:RocksDBOpenRange withOptions:nil error:nil];
+
+	RocksDBPerfContext *context = [RocksDBPerfContext contextByMeasuringBlock:^{
+		[_rocks dataForKey:@"a42".data error:nil];
+	} withPerfLevel:RocksDBPerfLevelEnableTime];
+
+	XCTAssertEqual(context.getReadBytes, 3);
+	XCTAssertGreaterThan(context.userKeyComparisonCount, 0);
+	XCTAssertGreaterThan(context.getFromOutputFilesTime, 0);
+
+	NSDictionary *dictionary = context.dictionaryRepresentation;
+	XCTAssertEqualObjects(dictionary[@"get_read_bytes"], @3);
+	XCTAssertNotNil(dictionary[@"bytes_read"]);
+	XCTAssertNil(context.nonZeroDictionaryRepresentation[@"write_wal_time"]);
+}
+
+- (void)testPerfContext_Reset
+{
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+	}];
+
+	RocksDBPerfLevel previous = [RocksDBPerfContext perfLevel];
+	[RocksDBPerfContext setPerfLevel:RocksDBPerfLevelEnableTime];
+	[RocksDBPerfContext reset];
+
+	[_rocks setData:@"value".data forKey:@"key".data error:nil];
+
+	RocksDBPerfContext *context = [RocksDBPerfContext currentContext];
+	XCTAssertGreaterThan(context.writeMemtableTime, 0);
+
+	[RocksDBPerfContext reset];
+	XCTAssertEqual([RocksDBPerfContext currentContext].writeMemtableTime, 0);
+
+	// Captured contexts are immutable
+	XCTAssertGreaterThan(context.writeMemtableTime, 0);
+
+	[RocksDBPerfContext setPerfLevel:previous];
+}
+
+@end
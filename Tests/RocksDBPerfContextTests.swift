@@ -0,0 +1,30 @@
+//
+//  RocksDBPerfContextTests.swift
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+import XCTest
+import ObjectiveRocks
+
+class RocksDBPerfContextTests : RocksDBTests {
+
+	func testSwift_PerfContext_Get() {
+		rocks = RocksDB.database(atPath: self.path, andDBOptions: { (options) -> Void in
+			options.createIfMissing = true
+		})
+
+		try! rocks.setData("value", forKey: "key")
+		try! rocks.compactRange(RocksDBOpenRange, withOptions: nil)
+
+		let context = RocksDBPerfContext.contextByMeasuringBlock({
+			_ = try? self.rocks.data(forKey: "key")
+		}, with: .enableTime)
+
+		XCTAssertEqual(context.getReadBytes, UInt64(5))
+		XCTAssertGreaterThan(context.userKeyComparisonCount, UInt64(0))
+		XCTAssertEqual(context.dictionaryRepresentation()["get_read_bytes"], 5)
+	}
+}
@@ -0,0 +1,139 @@
+//
+//  RocksDBPersistentCacheTests.mm
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#import "RocksDBTests.h"
+
+static const uint64_t kPersistentCacheSize = 128 * 1024 * 1024;
+
+@interface RocksDBPersistentCacheTests : RocksDBTests
+@end
+
+@implementation RocksDBPersistentCacheTests
+
+- (void)openDatabaseWithPersistentCache:(RocksDBPersistentCache *)persistentCache
+{
+	// A tiny block cache, so that almost every read misses it
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.tableFacotry = [RocksDBTableFactory blockBasedTableFactoryWithOptions:^(RocksDBBlockBasedTableOptions *options) {
+			options.blockCache = [RocksDBCache LRUCacheWithCapacity:64 * 1024];
+			options.persistentCache = persistentCache;
+		}];
+	}];
+
+	NSMutableData *value = [NSMutableData dataWithLength:1024];
+	for (int i = 0; i < 10000; i++) {
+		NSString *key = [NSString stringWithFormat:@"a%05d", i];
+		[_rocks setData:value forKey:key.data error:nil];
+	}
+	[_rocks compactRange:RocksDBOpenRange withOptions:nil error:nil];
+}
+
+- (void)readAllKeys
+{
+	for (int i = 0; i < 10000; i++) {
+		NSString *key = [NSString stringWithFormat:@"a%05d", (i * 7919) % 10000];
+		[_rocks dataForKey:key.data error:nil];
+	}
+}
+
+- (void)warmUpPersistentCache:(RocksDBPersistentCache *)persistentCache
+{
+	// Blocks are written to the persistent cache asynchronously
+	NSDate *deadline = [NSDate dateWithTimeIntervalSinceNow:10];
+	do {
+		[self readAllKeys];
+	} while ([persistentCache.statistics[@"persistentcache.blockcachetier.cache_hits"] doubleValue] == 0
+			 && deadline.timeIntervalSinceNow > 0);
+}
+
+- (void)testPersistentCache
+{
+	NSError *error = nil;
+	RocksDBPersistentCache *persistentCache = [RocksDBPersistentCache persistentCacheAtPath:_restorePath
+																					   size:kPersistentCacheSize
+																					  error:&error];
+	XCTAssertNil(error);
+	XCTAssertNotNil(persistentCache);
+	XCTAssertEqualObjects(persistentCache.path, _restorePath);
+	XCTAssertEqual(persistentCache.size, kPersistentCacheSize);
+	XCTAssertEqual(persistentCache.admissionPolicy, RocksDBPersistentCacheAdmissionPolicyAll);
+
+	[self openDatabaseWithPersistentCache:persistentCache];
+	[self warmUpPersistentCache:persistentCache];
+
+	XCTAssertGreaterThan([persistentCache.statistics[@"persistentcache.blockcachetier.cache_hits"] doubleValue], 0);
+	XCTAssertEqual([_rocks dataForKey:@"a00042".data error:nil].length, 1024);
+}
+
+- (void)testPersistentCache_SecondAccess
+{
+	RocksDBPersistentCache *persistentCache = [RocksDBPersistentCache persistentCacheAtPath:_restorePath
+																					   size:kPersistentCacheSize
+																			optimizedForNVM:NO
+																			admissionPolicy:RocksDBPersistentCacheAdmissionPolicySecondAccess
+																					  error:nil];
+	XCTAssertNotNil(persistentCache);
+
+	[self openDatabaseWithPersistentCache:persistentCache];
+	[self readAllKeys];
+
+	NSDictionary *statistics = persistentCache.statistics;
+	XCTAssertGreaterThan([statistics[@"objectiverocks.admission.rejected"] doubleValue], 0);
+
+	[self warmUpPersistentCache:persistentCache];
+
+	statistics = persistentCache.statistics;
+	XCTAssertGreaterThan([statistics[@"objectiverocks.admission.admitted"] doubleValue], 0);
+	XCTAssertGreaterThan([statistics[@"persistentcache.blockcachetier.cache_hits"] doubleValue], 0);
+}
+
+- (void)testPersistentCache_InvalidSize
+{
+	NSError *error = nil;
+	RocksDBPersistentCache *persistentCache = [RocksDBPersistentCache persistentCacheAtPath:_restorePath
+																					   size:1024 * 1024
+																					  error:&error];
+	XCTAssertNil(persistentCache);
+	XCTAssertNotNil(error);
+}
+
+- (void)testPersistentCache_EmptyPath
+{
+	NSError *error = nil;
+	RocksDBPersistentCache *persistentCache = [RocksDBPersistentCache persistentCacheAtPath:@""
+																					   size:kPersistentCacheSize
+																					  error:&error];
+	XCTAssertNil(persistentCache);
+	XCTAssertNotNil(error);
+}
+
+- (void)testPerformance_PersistentCache_BlockCacheMiss_Without
+{
+	[self openDatabaseWithPersistentCache:nil];
+	[self readAllKeys];
+
+	[self measureBlock:^{
+		[self readAllKeys];
+	}];
+}
+
+- (void)testPerformance_PersistentCache_BlockCacheMiss_With
+{
+	RocksDBPersistentCache *persistentCache = [RocksDBPersistentCache persistentCacheAtPath:_restorePath
+																					   size:kPersistentCacheSize
+																					  error:nil];
+	[self openDatabaseWithPersistentCache:persistentCache];
+	[self warmUpPersistentCache:persistentCache];
+
+	[self measureBlock:^{
+		[self readAllKeys];
+	}];
+}
+
+@end
@@ -0,0 +1,34 @@
+//
+//  RocksDBPersistentCacheTests.swift
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+import XCTest
+import ObjectiveRocks
+
+class RocksDBPersistentCacheTests : RocksDBTests {
+
+	func testSwift_PersistentCache() {
+		let persistentCache = try! RocksDBPersistentCache(atPath: self.restorePath,
+														  size: 128 * 1024 * 1024,
+														  optimizedForNVM: false,
+														  admissionPolicy: .secondAccess)
+
+		rocks = RocksDB.database(atPath: self.path, andDBOptions: { (options) -> Void in
+			options.createIfMissing = true
+			options.tableFacotry = RocksDBTableFactory.blockBasedTableFactory(options: { (options) -> Void in
+				options.persistentCache = persistentCache
+			})
+		})
+
+		try! rocks.setData("value 1", forKey: "key 1")
+		try! rocks.compactRange(RocksDBOpenRange, withOptions: nil)
+
+		XCTAssertEqual(try! rocks.data(forKey: "key 1"), "value 1".data)
+		XCTAssertEqual(persistentCache.admissionPolicy, .secondAccess)
+		XCTAssertNotNil(persistentCache.statistics()["objectiverocks.admission.rejected"])
+	}
+}
@@ -10,6 +10,21 @@
 
 #import "ObjectiveRocks.h"
 
+static size_t PrefixTransformFunction(void *context, const char *key, size_t length)
+{
+	return *(size_t *)context;
+}
+
+static bool PrefixCandidateFunction(void *context, const char *key, size_t length)
+{
+	return length >= *(size_t *)context;
+}
+
+static bool ValidPrefixFunction(void *context, const char *prefix, size_t length)
+{
+	return length == *(size_t *)context;
+}
+
 @interface RocksDBPrefixExtractorTests : RocksDBTests
 
 @end
@@ -124,4 +139,243 @@
 	XCTAssertEqualObjects(keys, expected);
 }
 
+- (void)testPrefixExtractor_Functions
+{
+	static size_t prefixLength = 3;
+
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.prefixExtractor = [[RocksDBPrefixExtractor alloc] initWithName:@"fixed"
+																	   context:&prefixLength
+															 transformFunction:&PrefixTransformFunction
+													   prefixCandidateFunction:&PrefixCandidateFunction
+														   validPrefixFunction:&ValidPrefixFunction];
+	}];
+
+	[_rocks setData:@"x".data forKey:@"100A".data error:nil];
+	[_rocks setData:@"x".data forKey:@"100B".data error:nil];
+	[_rocks setData:@"x".data forKey:@"101A".data error:nil];
+	[_rocks setData:@"x".data forKey:@"101B".data error:nil];
+
+	RocksDBIterator *iterator = [_rocks iterator];
+
+	NSMutableArray *keys = [NSMutableArray array];
+	[iterator enumerateKeysWithPrefix:@"100".data usingBlock:^(NSData *key, BOOL *stop) {
+		[keys addObject:[[NSString alloc] initWithData:key]];
+	}];
+
+	NSArray *expected = @[@"100A", @"100B"];
+	XCTAssertEqualObjects(keys, expected);
+
+	[iterator close];
+}
+
+- (void)testPrefixExtractor_CappedLength
+{
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.prefixExtractor = [RocksDBPrefixExtractor prefixExtractorWithType:RocksDBPrefixCappedLength length:3];
+	}];
+
+	[_rocks setData:@"x".data forKey:@"10".data error:nil];
+	[_rocks setData:@"x".data forKey:@"100A".data error:nil];
+	[_rocks setData:@"x".data forKey:@"100B".data error:nil];
+	[_rocks setData:@"x".data forKey:@"101A".data error:nil];
+
+	RocksDBIterator *iterator = [_rocks iterator];
+
+	NSMutableArray *keys = [NSMutableArray array];
+	[iterator enumerateKeysWithPrefix:@"100".data usingBlock:^(NSData *key, BOOL *stop) {
+		[keys addObject:[[NSString alloc] initWithData:key]];
+	}];
+
+	NSArray *expected = @[@"100A", @"100B"];
+	XCTAssertEqualObjects(keys, expected);
+
+	keys = [NSMutableArray array];
+	[iterator enumerateKeysWithPrefix:@"10".data usingBlock:^(NSData *key, BOOL *stop) {
+		[keys addObject:[[NSString alloc] initWithData:key]];
+	}];
+
+	expected = @[@"10"];
+	XCTAssertEqualObjects(keys, expected);
+
+	[iterator close];
+}
+
+- (void)testPrefixExtractor_Delimiter
+{
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.prefixExtractor = [RocksDBPrefixExtractor prefixExtractorWithDelimiter:':' count:2];
+	}];
+
+	[_rocks setData:@"x".data forKey:@"acme:user:1".data error:nil];
+	[_rocks setData:@"x".data forKey:@"acme:user:2".data error:nil];
+	[_rocks setData:@"x".data forKey:@"acme:users:1".data error:nil];
+	[_rocks setData:@"x".data forKey:@"acme:order:1".data error:nil];
+	[_rocks setData:@"x".data forKey:@"initech:user:1".data error:nil];
+
+	[_rocks compactRange:RocksDBOpenRange withOptions:nil error:nil];
+
+	RocksDBIterator *iterator = [_rocks iterator];
+
+	NSMutableArray *keys = [NSMutableArray array];
+	[iterator enumerateKeysWithPrefix:@"acme:user:".data usingBlock:^(NSData *key, BOOL *stop) {
+		[keys addObject:[[NSString alloc] initWithData:key]];
+	}];
+
+	NSArray *expected = @[@"acme:user:1", @"acme:user:2"];
+	XCTAssertEqualObjects(keys, expected);
+
+	keys = [NSMutableArray array];
+	[iterator enumerateKeysWithPrefix:@"initech:user:".data usingBlock:^(NSData *key, BOOL *stop) {
+		[keys addObject:[[NSString alloc] initWithData:key]];
+	}];
+
+	expected = @[@"initech:user:1"];
+	XCTAssertEqualObjects(keys, expected);
+
+	[iterator close];
+}
+
+#pragma mark - Performance
+
+- (NSArray<NSData *> *)hierarchicalKeys
+{
+	NSMutableArray *keys = [NSMutableArray array];
+	for (uint32_t i = 0; i < 10000; i++) {
+		NSString *key = [NSString stringWithFormat:@"tenant%u:entity%u:%u", i % 100, arc4random_uniform(1000), arc4random()];
+		[keys addObject:key.data];
+	}
+	return keys;
+}
+
+- (RocksDB *)openDatabaseWithPrefixExtractor:(RocksDBPrefixExtractor *)extractor
+{
+	return [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.prefixExtractor = extractor;
+		options.writeBufferSize = 64 * 1024 * 1024;
+
+		options.tableFacotry = [RocksDBTableFactory blockBasedTableFactoryWithOptions:^(RocksDBBlockBasedTableOptions *options) {
+			options.filterPolicy = [RocksDBFilterPolicy bloomFilterPolicyWithBitsPerKey:10 useBlockBasedBuilder:NO];
+		}];
+	}];
+}
+
+- (void)measureInsertsWithPrefixExtractor:(RocksDBPrefixExtractor *)extractor
+{
+	NSArray *keys = [self hierarchicalKeys];
+
+	[self measureBlock:^{
+		[[NSFileManager defaultManager] removeItemAtPath:_path error:nil];
+
+		RocksDB *db = [self openDatabaseWithPrefixExtractor:extractor];
+		for (NSData *key in keys) {
+			[db setData:key forKey:key error:nil];
+		}
+		[db close];
+	}];
+}
+
+#if !(defined(ROCKSDB_LITE) && defined(TARGET_OS_IPHONE))
+
+- (void)measurePrefixBloomWithPrefixExtractor:(RocksDBPrefixExtractor *)extractor
+									 prefixes:(NSArray<NSData *> *)prefixes
+{
+	RocksDBStatistics *statistics = [RocksDBStatistics new];
+	RocksDB *db = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.prefixExtractor = extractor;
+		options.statistics = statistics;
+
+		options.tableFacotry = [RocksDBTableFactory blockBasedTableFactoryWithOptions:^(RocksDBBlockBasedTableOptions *options) {
+			options.filterPolicy = [RocksDBFilterPolicy bloomFilterPolicyWithBitsPerKey:10 useBlockBasedBuilder:NO];
+		}];
+	}];
+
+	for (NSData *key in [self hierarchicalKeys]) {
+		[db setData:key forKey:key error:nil];
+	}
+	[db compactRange:RocksDBOpenRange withOptions:nil error:nil];
+
+	[self measureBlock:^{
+		RocksDBIterator *iterator = [db iterator];
+		for (NSData *prefix in prefixes) {
+			[iterator enumerateKeysWithPrefix:prefix usingBlock:^(NSData *key, BOOL *stop) {}];
+		}
+		[iterator close];
+	}];
+
+	uint64_t checked = [statistics countForTicker:RocksDBTickerBloomFilterPrefixChecked];
+	uint64_t useful = [statistics countForTicker:RocksDBTickerBloomFilterPrefixUseful];
+	XCTAssertGreaterThan(checked, 0);
+	// None of the prefixes exist, thus the bloom filter rules out nearly all of them
+	XCTAssertGreaterThan(useful, checked / 2);
+
+	[db close];
+}
+
+#endif
+
+- (NSArray<NSData *> *)missingPrefixes
+{
+	NSMutableArray *prefixes = [NSMutableArray array];
+	for (uint32_t i = 0; i < 1000; i++) {
+		[prefixes addObject:[NSString stringWithFormat:@"tenant%u:entity%u:", 100 + i, i].data];
+	}
+	return prefixes;
+}
+
+- (RocksDBPrefixExtractor *)blockDelimiterPrefixExtractor
+{
+	return [[RocksDBPrefixExtractor alloc] initWithName:@"block_delimiter"
+										 transformBlock:^NSData *(NSData *key) {
+											 const char *bytes = (const char *)key.bytes;
+											 const char *first = (const char *)memchr(bytes, ':', key.length);
+											 const char *second = (const char *)memchr(first + 1, ':', key.length - (first + 1 - bytes));
+											 return [key subdataWithRange:NSMakeRange(0, second - bytes + 1)];
+										 }
+								   prefixCandidateBlock:^BOOL(NSData *key) {
+									   const char *bytes = (const char *)key.bytes;
+									   const char *first = (const char *)memchr(bytes, ':', key.length);
+									   return first != NULL && memchr(first + 1, ':', key.length - (first + 1 - bytes)) != NULL;
+								   }
+									   validPrefixBlock:^BOOL(NSData *prefix) {
+										   return YES;
+									   }];
+}
+
+- (void)testPerformance_PrefixExtractor_Insert_Block
+{
+	[self measureInsertsWithPrefixExtractor:[self blockDelimiterPrefixExtractor]];
+}
+
+- (void)testPerformance_PrefixExtractor_Insert_Delimiter
+{
+	[self measureInsertsWithPrefixExtractor:[RocksDBPrefixExtractor prefixExtractorWithDelimiter:':' count:2]];
+}
+
+- (void)testPerformance_PrefixExtractor_Insert_CappedLength
+{
+	[self measureInsertsWithPrefixExtractor:[RocksDBPrefixExtractor prefixExtractorWithType:RocksDBPrefixCappedLength length:16]];
+}
+
+#if !(defined(ROCKSDB_LITE) && defined(TARGET_OS_IPHONE))
+
+- (void)testPerformance_PrefixExtractor_Bloom_Delimiter
+{
+	[self measurePrefixBloomWithPrefixExtractor:[RocksDBPrefixExtractor prefixExtractorWithDelimiter:':' count:2]
+									   prefixes:[self missingPrefixes]];
+}
+
+- (void)testPerformance_PrefixExtractor_Bloom_CappedLength
+{
+	[self measurePrefixBloomWithPrefixExtractor:[RocksDBPrefixExtractor prefixExtractorWithType:RocksDBPrefixCappedLength length:16]
+									   prefixes:[self missingPrefixes]];
+}
+
+#endif
+
 @end
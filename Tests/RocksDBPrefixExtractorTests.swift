@@ -132,4 +132,97 @@ class RocksDBPrefixExtractorTests : RocksDBTests {
 		expected = ["5313", "5323"]
 		XCTAssertEqual(keys, expected);
 	}
+
+	func testSwift_PrefixExtractor_Functions() {
+		let transform: RocksDBPrefixTransformFunction = { (context, key, length) -> Int in
+			return 3
+		}
+		let candidate: RocksDBPrefixPredicateFunction = { (context, key, length) -> Bool in
+			return length >= 3
+		}
+		let valid: RocksDBPrefixPredicateFunction = { (context, prefix, length) -> Bool in
+			return length == 3
+		}
+
+		rocks = RocksDB.database(atPath: self.path, andDBOptions: { (options) -> Void in
+			options.createIfMissing = true
+			options.prefixExtractor = RocksDBPrefixExtractor(name: "fixed",
+			                                                 context: nil,
+			                                                 transformFunction: transform,
+			                                                 prefixCandidateFunction: candidate,
+			                                                 validPrefixFunction: valid)
+		})
+
+		try! rocks.setData("x", forKey: "100A")
+		try! rocks.setData("x", forKey: "100B")
+		try! rocks.setData("x", forKey: "101A")
+		try! rocks.setData("x", forKey: "101B")
+
+		let iterator = rocks.iterator()
+		var keys = [String]()
+
+		iterator.enumerateKeys(withPrefix: "100", using: { (key, stop) -> Void in
+			keys.append(String(data: key, encoding: .utf8)!)
+		})
+
+		XCTAssertEqual(keys, ["100A", "100B"])
+
+		iterator.close()
+	}
+
+	func testSwift_PrefixExtractor_CappedLength() {
+		rocks = RocksDB.database(atPath: self.path, andDBOptions: { (options) -> Void in
+			options.createIfMissing = true
+			options.prefixExtractor = RocksDBPrefixExtractor(type: .cappedLength, length: 3)
+		})
+
+		try! rocks.setData("x", forKey: "10")
+		try! rocks.setData("x", forKey: "100A")
+		try! rocks.setData("x", forKey: "100B")
+		try! rocks.setData("x", forKey: "101A")
+
+		let iterator = rocks.iterator()
+		var keys = [String]()
+
+		iterator.enumerateKeys(withPrefix: "100", using: { (key, stop) -> Void in
+			keys.append(String(data: key, encoding: .utf8)!)
+		})
+
+		XCTAssertEqual(keys, ["100A", "100B"])
+
+		keys.removeAll()
+		iterator.enumerateKeys(withPrefix: "10", using: { (key, stop) -> Void in
+			keys.append(String(data: key, encoding: .utf8)!)
+		})
+
+		XCTAssertEqual(keys, ["10"])
+
+		iterator.close()
+	}
+
+	func testSwift_PrefixExtractor_Delimiter() {
+		rocks = RocksDB.database(atPath: self.path, andDBOptions: { (options) -> Void in
+			options.createIfMissing = true
+			options.prefixExtractor = RocksDBPrefixExtractor(delimiter: UInt8(ascii: ":"), count: 2)
+		})
+
+		try! rocks.setData("x", forKey: "acme:user:1")
+		try! rocks.setData("x", forKey: "acme:user:2")
+		try! rocks.setData("x", forKey: "acme:users:1")
+		try! rocks.setData("x", forKey: "acme:order:1")
+		try! rocks.setData("x", forKey: "initech:user:1")
+
+		try! rocks.compactRange(RocksDBOpenRange, withOptions: nil)
+
+		let iterator = rocks.iterator()
+		var keys = [String]()
+
+		iterator.enumerateKeys(withPrefix: "acme:user:", using: { (key, stop) -> Void in
+			keys.append(String(data: key, encoding: .utf8)!)
+		})
+
+		XCTAssertEqual(keys, ["acme:user:1", "acme:user:2"])
+
+		iterator.close()
+	}
 }
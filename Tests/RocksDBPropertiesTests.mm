@@ -50,4 +50,54 @@
 	XCTAssertNotNil([(RocksDB *)_rocks.columnFamilies[1] valueForProperty:RocksDBPropertySsTables]);
 }
 
+- (void)testProperties_Extended
+{
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+	}];
+
+	for (int i = 0; i < 100; i++) {
+		NSString *str = [NSString stringWithFormat:@"a%d", i];
+		[_rocks setData:str.data forKey:str.data error:nil];
+	}
+	[_rocks compactRange:RocksDBOpenRange withOptions:nil error:nil];
+
+	XCTAssertGreaterThan([_rocks valueForIntProperty:RocksDBIntPropertyEstimatedLiveDataSize], 0);
+	XCTAssertGreaterThan([_rocks valueForIntProperty:RocksDBIntPropertyTotalSstFilesSize], 0);
+	XCTAssertGreaterThan([_rocks valueForIntProperty:RocksDBIntPropertyLiveSstFilesSize], 0);
+	XCTAssertGreaterThan([_rocks valueForIntProperty:RocksDBIntPropertyBlockCacheCapacity], 0);
+	XCTAssertEqual([_rocks valueForIntProperty:RocksDBIntPropertyIsWriteStopped], 0);
+	XCTAssertEqual([_rocks valueForIntProperty:RocksDBIntPropertyActualDelayedWriteRate], 0);
+
+	NSString *tableProperties = [_rocks valueForProperty:RocksDBPropertyAggregatedTableProperties];
+	XCTAssertTrue([tableProperties containsString:@"# entries=100"]);
+}
+
+- (void)testProperties_Batch
+{
+	RocksDBColumnFamilyDescriptor *descriptor = [RocksDBColumnFamilyDescriptor new];
+	[descriptor addDefaultColumnFamilyWithOptions:nil];
+	[descriptor addColumnFamilyWithName:@"new_cf" andOptions:nil];
+
+	_rocks = [RocksDB databaseAtPath:_path columnFamilies:descriptor andDatabaseOptions:^(RocksDBDatabaseOptions *options) {
+		options.createIfMissing = YES;
+		options.createMissingColumnFamilies = YES;
+	}];
+
+	[_rocks.columnFamilies[1] setData:@"value 1".data forKey:@"key 1".data error:nil];
+	[_rocks.columnFamilies[1] setData:@"value 2".data forKey:@"key 2".data error:nil];
+
+	NSDictionary *values = [_rocks valuesForIntProperties:@[@(RocksDBIntPropertyNumEntriesActiveMemtable),
+															@(RocksDBIntPropertyNumRunningFlushes),
+															@(RocksDBIntPropertyEstimatedOldestKeyTime)]];
+
+	XCTAssertEqual(values.count, 2);
+	XCTAssertEqualObjects(values[@"default"][@(RocksDBIntPropertyNumEntriesActiveMemtable)], @0);
+	XCTAssertEqualObjects(values[@"new_cf"][@(RocksDBIntPropertyNumEntriesActiveMemtable)], @2);
+	XCTAssertNotNil(values[@"new_cf"][@(RocksDBIntPropertyNumRunningFlushes)]);
+
+	// Only available with FIFO compaction
+	XCTAssertNil(values[@"new_cf"][@(RocksDBIntPropertyEstimatedOldestKeyTime)]);
+}
+
 @end
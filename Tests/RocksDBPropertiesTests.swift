@@ -45,4 +45,19 @@ class RocksDBPropertiesTests : RocksDBTests {
 		XCTAssertNotNil((rocks.columnFamilies()[1]).value(for: .stats));
 		XCTAssertNotNil((rocks.columnFamilies()[1]).value(for: .ssTables));
 	}
+
+	func testSwift_Properties_Batch() {
+		rocks = RocksDB.database(atPath: self.path, andDBOptions: { (options) -> Void in
+			options.createIfMissing = true
+		})
+
+		try! rocks.setData("value 1".data, forKey: "key 1".data)
+		try! rocks.setData("value 2".data, forKey: "key 2".data)
+
+		let properties = [RocksDBIntProperty.numEntriesActiveMemtable, .blockCacheCapacity]
+		let values = rocks.values(forIntProperties: properties.map { NSNumber(value: $0.rawValue) })
+
+		XCTAssertEqual(values["default"]?[NSNumber(value: RocksDBIntProperty.numEntriesActiveMemtable.rawValue)], 2)
+		XCTAssertNotNil(values["default"]?[NSNumber(value: RocksDBIntProperty.blockCacheCapacity.rawValue)])
+	}
 }
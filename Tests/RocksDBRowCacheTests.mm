@@ -0,0 +1,171 @@
+//
+//  RocksDBRowCacheTests.mm
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#import "RocksDBTests.h"
+
+#include <vector>
+#include <cmath>
+#include <random>
+#include <algorithm>
+
+static const int kNumberOfKeys = 100000;
+
+@interface RocksDBRowCacheTests : RocksDBTests
+@end
+
+@implementation RocksDBRowCacheTests
+
+- (void)testRowCache
+{
+	RocksDBCache *rowCache = [RocksDBCache LRUCacheWithCapacity:1024 * 1024];
+	RocksDBStatistics *statistics = [RocksDBStatistics new];
+
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.rowCache = rowCache;
+		options.statistics = statistics;
+	}];
+	XCTAssertEqual(_rocks.rowCacheHitCount, 0);
+	XCTAssertEqual(_rocks.rowCacheMissCount, 0);
+
+	[_rocks setData:@"value 1".data forKey:@"key 1".data error:nil];
+	[_rocks compactRange:RocksDBOpenRange withOptions:nil error:nil];
+
+	XCTAssertEqualObjects([_rocks dataForKey:@"key 1".data error:nil], @"value 1".data);
+	XCTAssertEqual(_rocks.rowCacheHitCount, 0);
+	XCTAssertEqual(_rocks.rowCacheMissCount, 1);
+
+	XCTAssertEqualObjects([_rocks dataForKey:@"key 1".data error:nil], @"value 1".data);
+	XCTAssertEqualObjects([_rocks dataForKey:@"key 1".data error:nil], @"value 1".data);
+	XCTAssertEqual(_rocks.rowCacheHitCount, 2);
+	XCTAssertEqual(_rocks.rowCacheMissCount, 1);
+
+	XCTAssertEqual([statistics countForTicker:RocksDBTickerRowCacheHit], 2);
+	XCTAssertEqual([statistics countForTicker:RocksDBTickerRowCacheMiss], 1);
+	XCTAssertGreaterThan(rowCache.usage, 0);
+}
+
+- (void)testRowCache_ColumnFamilies
+{
+	RocksDBColumnFamilyDescriptor *descriptor = [RocksDBColumnFamilyDescriptor new];
+	[descriptor addDefaultColumnFamilyWithOptions:nil];
+	[descriptor addColumnFamilyWithName:@"new_cf" andOptions:nil];
+
+	_rocks = [RocksDB databaseAtPath:_path columnFamilies:descriptor andDatabaseOptions:^(RocksDBDatabaseOptions *options) {
+		options.createIfMissing = YES;
+		options.createMissingColumnFamilies = YES;
+		options.rowCache = [RocksDBCache LRUCacheWithCapacity:1024 * 1024];
+	}];
+
+	RocksDBColumnFamily *defaultColumnFamily = _rocks.columnFamilies[0];
+	RocksDBColumnFamily *newColumnFamily = _rocks.columnFamilies[1];
+
+	[defaultColumnFamily setData:@"value 1".data forKey:@"key 1".data error:nil];
+	[defaultColumnFamily compactRange:RocksDBOpenRange withOptions:nil error:nil];
+	[newColumnFamily setData:@"value 2".data forKey:@"key 2".data error:nil];
+	[newColumnFamily compactRange:RocksDBOpenRange withOptions:nil error:nil];
+
+	for (int i = 0; i < 3; i++) {
+		[defaultColumnFamily dataForKey:@"key 1".data error:nil];
+	}
+	[newColumnFamily dataForKey:@"key 2".data error:nil];
+
+	XCTAssertEqual(defaultColumnFamily.rowCacheHitCount, 2);
+	XCTAssertEqual(defaultColumnFamily.rowCacheMissCount, 1);
+	XCTAssertEqual(_rocks.rowCacheHitCount, 2);
+	XCTAssertEqual(newColumnFamily.rowCacheHitCount, 0);
+	XCTAssertEqual(newColumnFamily.rowCacheMissCount, 1);
+
+	[defaultColumnFamily close];
+	[newColumnFamily close];
+}
+
+- (void)testRowCache_NoRowCache
+{
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+	}];
+
+	[_rocks setData:@"value 1".data forKey:@"key 1".data error:nil];
+	[_rocks compactRange:RocksDBOpenRange withOptions:nil error:nil];
+	[_rocks dataForKey:@"key 1".data error:nil];
+
+	XCTAssertEqual(_rocks.rowCacheHitCount, 0);
+	XCTAssertEqual(_rocks.rowCacheMissCount, 0);
+}
+
+#pragma mark - Performance
+
+- (void)openDatabaseWithRowCache:(RocksDBCache *)rowCache
+{
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.rowCache = rowCache;
+		options.tableFacotry = [RocksDBTableFactory blockBasedTableFactoryWithOptions:^(RocksDBBlockBasedTableOptions *options) {
+			options.blockCache = [RocksDBCache LRUCacheWithCapacity:256 * 1024 * 1024];
+		}];
+	}];
+
+	NSMutableData *value = [NSMutableData dataWithLength:100];
+	for (int i = 0; i < kNumberOfKeys; i++) {
+		NSString *key = [NSString stringWithFormat:@"a%06d", i];
+		[_rocks setData:value forKey:key.data error:nil];
+	}
+	[_rocks compactRange:RocksDBOpenRange withOptions:nil error:nil];
+}
+
+// Keys drawn from a Zipfian distribution with an exponent of 0.99, as in YCSB
+- (NSArray<NSData *> *)zipfianKeysWithCount:(int)count
+{
+	std::vector<double> cdf(kNumberOfKeys);
+	double sum = 0;
+	for (int i = 0; i < kNumberOfKeys; i++) {
+		sum += 1.0 / pow(i + 1, 0.99);
+		cdf[i] = sum;
+	}
+
+	std::mt19937 generator(42);
+	std::uniform_real_distribution<double> distribution(0, sum);
+
+	NSMutableArray<NSData *> *keys = [NSMutableArray arrayWithCapacity:count];
+	for (int i = 0; i < count; i++) {
+		long rank = std::lower_bound(cdf.begin(), cdf.end(), distribution(generator)) - cdf.begin();
+		// Spread the hot keys over the key space
+		long idx = (rank * 7919) % kNumberOfKeys;
+		[keys addObject:[NSString stringWithFormat:@"a%06ld", idx].data];
+	}
+	return keys;
+}
+
+- (void)measureZipfianReads
+{
+	NSArray<NSData *> *keys = [self zipfianKeysWithCount:100000];
+	for (NSData *key in keys) {
+		[_rocks dataForKey:key error:nil];
+	}
+
+	[self measureBlock:^{
+		for (NSData *key in keys) {
+			[_rocks dataForKey:key error:nil];
+		}
+	}];
+}
+
+- (void)testPerformance_RowCache_Zipfian_BlockCacheOnly
+{
+	[self openDatabaseWithRowCache:nil];
+	[self measureZipfianReads];
+}
+
+- (void)testPerformance_RowCache_Zipfian_RowCache
+{
+	[self openDatabaseWithRowCache:[RocksDBCache LRUCacheWithCapacity:8 * 1024 * 1024]];
+	[self measureZipfianReads];
+}
+
+@end
@@ -0,0 +1,29 @@
+//
+//  RocksDBRowCacheTests.swift
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+import XCTest
+import ObjectiveRocks
+
+class RocksDBRowCacheTests : RocksDBTests {
+
+	func testSwift_RowCache() {
+		rocks = RocksDB.database(atPath: self.path, andDBOptions: { (options) -> Void in
+			options.createIfMissing = true
+			options.rowCache = RocksDBCache.lruCache(withCapacity: 1024 * 1024)
+		})
+
+		try! rocks.setData("value 1", forKey: "key 1")
+		try! rocks.compactRange(RocksDBOpenRange, withOptions: nil)
+
+		XCTAssertEqual(try! rocks.data(forKey: "key 1"), "value 1".data)
+		XCTAssertEqual(try! rocks.data(forKey: "key 1"), "value 1".data)
+
+		XCTAssertEqual(rocks.rowCacheHitCount(), 1)
+		XCTAssertEqual(rocks.rowCacheMissCount(), 1)
+	}
+}
@@ -68,4 +68,269 @@
 	XCTAssertGreaterThan(dbGetHistogram.median, 0.0);
 }
 
+- (void)testStatistics_Histogram_Full
+{
+	RocksDBStatistics *statistics = [RocksDBStatistics new];
+
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.statistics = statistics;
+	}];
+
+	for (int i = 0; i < 1000; i++) {
+		NSString *str = [NSString stringWithFormat:@"a%d", i];
+		[_rocks setData:str.data forKey:str.data error:nil];
+	}
+
+	RocksDBStatisticsHistogram *histogram = [statistics histogramDataForType:RocksDBHistogramBytesPerWrite];
+
+	XCTAssertEqual(histogram.count, 1000);
+	XCTAssertGreaterThan(histogram.sum, 0);
+	XCTAssertGreaterThan(histogram.max, 0.0);
+	XCTAssertLessThanOrEqual(histogram.min, histogram.median);
+	XCTAssertLessThanOrEqual(histogram.median, histogram.percentile95);
+	XCTAssertLessThanOrEqual(histogram.percentile95, histogram.percentile99);
+	XCTAssertLessThanOrEqual(histogram.percentile99, histogram.percentile999);
+	XCTAssertLessThanOrEqual(histogram.percentile999, histogram.max);
+	XCTAssertGreaterThan(histogram.percentile99, 0.0);
+
+	XCTAssertGreaterThan(histogram.bucketCounts.count, 0);
+	XCTAssertEqual(histogram.bucketCounts.count, histogram.bucketUpperBounds.count);
+	XCTAssertEqual(histogram.bucketCounts.count, histogram.bucketLowerBounds.count);
+
+	uint64_t total = 0;
+	for (NSNumber *count in histogram.bucketCounts) {
+		total += count.unsignedLongLongValue;
+	}
+	XCTAssertEqual(total, histogram.count);
+	XCTAssertEqualWithAccuracy([histogram valueAtPercentile:99], histogram.percentile99, 0.01);
+}
+
+- (void)testStatistics_Histogram_Merge
+{
+	RocksDBStatistics *statistics = [RocksDBStatistics new];
+
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.statistics = statistics;
+	}];
+
+	for (int i = 0; i < 100; i++) {
+		NSString *str = [NSString stringWithFormat:@"a%d", i];
+		[_rocks setData:str.data forKey:str.data error:nil];
+	}
+
+	RocksDBStatisticsHistogram *histogram = [statistics histogramDataForType:RocksDBHistogramBytesPerWrite];
+	RocksDBStatisticsHistogram *merged = [histogram histogramByMergingHistogram:histogram];
+
+	XCTAssertEqual(merged.count, 2 * histogram.count);
+	XCTAssertEqual(merged.sum, 2 * histogram.sum);
+	XCTAssertEqual(merged.min, histogram.min);
+	XCTAssertEqual(merged.max, histogram.max);
+	XCTAssertEqualWithAccuracy(merged.average, histogram.average, 0.001);
+	XCTAssertEqualWithAccuracy(merged.standardDeviation, histogram.standardDeviation, 0.01);
+	XCTAssertEqualWithAccuracy(merged.percentile99, histogram.percentile99, 0.01);
+	XCTAssertEqualObjects(merged.bucketUpperBounds, histogram.bucketUpperBounds);
+	XCTAssertEqual(merged.bucketCounts.firstObject.unsignedLongLongValue, 2 * histogram.bucketCounts.firstObject.unsignedLongLongValue);
+}
+
+- (void)testStatistics_Snapshot
+{
+	RocksDBStatistics *statistics = [RocksDBStatistics new];
+
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.statistics = statistics;
+	}];
+
+	for (int i = 0; i < 100; i++) {
+		NSString *str = [NSString stringWithFormat:@"a%d", i];
+		[_rocks setData:str.data forKey:str.data error:nil];
+	}
+
+	RocksDBStatisticsSnapshot *first = [statistics snapshot];
+
+	XCTAssertEqual([first countForTicker:RocksDBTickerBytesWritten], [statistics countForTicker:RocksDBTickerBytesWritten]);
+	XCTAssertEqual([first countForTicker:RocksDBTickerNumberKeysWritten], 100);
+	XCTAssertEqual([first countForHistogram:RocksDBHistogramDBWrite], 100);
+	XCTAssertEqual(first.interval, 0.0);
+
+	for (int i = 0; i < 10; i++) {
+		NSString *str = [NSString stringWithFormat:@"a%d", i];
+		[_rocks dataForKey:str.data error:nil];
+	}
+
+	// Snapshots are immutable
+	XCTAssertEqual([first countForTicker:RocksDBTickerNumberKeysRead], 0);
+
+	RocksDBStatisticsSnapshot *second = [statistics snapshot];
+	RocksDBStatisticsSnapshot *delta = [second deltaFromSnapshot:first];
+
+	XCTAssertEqual([second countForTicker:RocksDBTickerNumberKeysRead], 10);
+	XCTAssertEqual([delta countForTicker:RocksDBTickerNumberKeysRead], 10);
+	XCTAssertEqual([delta countForTicker:RocksDBTickerNumberKeysWritten], 0);
+	XCTAssertEqual([delta countForHistogram:RocksDBHistogramDBGet], 10);
+	XCTAssertEqual([delta countForHistogram:RocksDBHistogramDBWrite], 0);
+	XCTAssertGreaterThanOrEqual(delta.interval, 0.0);
+	XCTAssertEqual(delta.timestamp, second.timestamp);
+
+	RocksDBStatisticsHistogram *histogram = [delta histogramDataForType:RocksDBHistogramDBGet];
+	XCTAssertEqualWithAccuracy(histogram.average, (double)[delta sumForHistogram:RocksDBHistogramDBGet] / 10, 0.001);
+}
+
+- (void)testStatistics_Snapshot_Buckets
+{
+	RocksDBStatistics *statistics = [RocksDBStatistics new];
+
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.statistics = statistics;
+	}];
+
+	for (int i = 0; i < 100; i++) {
+		NSString *str = [NSString stringWithFormat:@"a%d", i];
+		[_rocks setData:str.data forKey:str.data error:nil];
+	}
+
+	RocksDBStatisticsSnapshot *first = [statistics snapshot];
+	RocksDBStatisticsHistogram *histogram = [first histogramDataForType:RocksDBHistogramBytesPerWrite];
+	RocksDBStatisticsHistogram *live = [statistics histogramDataForType:RocksDBHistogramBytesPerWrite];
+
+	XCTAssertGreaterThan(histogram.bucketCounts.count, 0);
+	XCTAssertEqualObjects(histogram.bucketUpperBounds, live.bucketUpperBounds);
+	XCTAssertEqualObjects(histogram.bucketCounts, live.bucketCounts);
+	XCTAssertGreaterThan(histogram.percentile999, 0.0);
+	XCTAssertEqualWithAccuracy(histogram.percentile999, live.percentile999, 0.01);
+
+	// Values large enough to land in buckets none of the earlier writes filled
+	NSData *value = [NSMutableData dataWithLength:64 * 1024];
+	for (int i = 0; i < 10; i++) {
+		NSString *str = [NSString stringWithFormat:@"b%d", i];
+		[_rocks setData:value forKey:str.data error:nil];
+	}
+
+	RocksDBStatisticsSnapshot *second = [statistics snapshot];
+	RocksDBStatisticsHistogram *delta = [[second deltaFromSnapshot:first] histogramDataForType:RocksDBHistogramBytesPerWrite];
+
+	XCTAssertEqual(delta.count, 10);
+	uint64_t total = 0;
+	for (NSNumber *count in delta.bucketCounts) {
+		total += count.unsignedLongLongValue;
+	}
+	XCTAssertEqual(total, 10);
+	XCTAssertGreaterThan(delta.median, 50000);
+	XCTAssertGreaterThan(delta.percentile999, 50000);
+
+	// The delta merges with the earlier values into the cumulative histogram
+	RocksDBStatisticsHistogram *merged = [histogram histogramByMergingHistogram:delta];
+	XCTAssertEqualObjects(merged.bucketCounts, [second histogramDataForType:RocksDBHistogramBytesPerWrite].bucketCounts);
+}
+
+- (void)testStatistics_StatsLevel
+{
+	RocksDBStatistics *statistics = [RocksDBStatistics new];
+	XCTAssertEqual(statistics.statsLevel, RocksDBStatsLevelExceptDetailedTimers);
+
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.statistics = statistics;
+	}];
+
+	statistics.statsLevel = RocksDBStatsLevelExceptHistogramOrTimers;
+	XCTAssertEqual(statistics.statsLevel, RocksDBStatsLevelExceptHistogramOrTimers);
+
+	for (int i = 0; i < 10; i++) {
+		NSString *str = [NSString stringWithFormat:@"a%d", i];
+		[_rocks setData:str.data forKey:str.data error:nil];
+	}
+
+	XCTAssertEqual([statistics countForTicker:RocksDBTickerNumberKeysWritten], 10);
+	XCTAssertEqual([statistics histogramDataForType:RocksDBHistogramDBWrite].count, 0);
+
+	statistics.statsLevel = RocksDBStatsLevelAll;
+
+	for (int i = 0; i < 10; i++) {
+		NSString *str = [NSString stringWithFormat:@"b%d", i];
+		[_rocks setData:str.data forKey:str.data error:nil];
+	}
+
+	XCTAssertEqual([statistics countForTicker:RocksDBTickerNumberKeysWritten], 20);
+	XCTAssertEqual([statistics histogramDataForType:RocksDBHistogramDBWrite].count, 10);
+}
+
+- (void)measureOperationsWithStatistics:(RocksDBStatistics *)statistics
+{
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.statistics = statistics;
+	}];
+
+	NSMutableArray *keys = [NSMutableArray arrayWithCapacity:10000];
+	for (int i = 0; i < 10000; i++) {
+		[keys addObject:[NSString stringWithFormat:@"a%d", i].data];
+	}
+
+	[self measureBlock:^{
+		for (NSData *key in keys) {
+			[_rocks setData:key forKey:key error:nil];
+		}
+		for (NSData *key in keys) {
+			[_rocks dataForKey:key error:nil];
+		}
+	}];
+}
+
+- (void)measureOperationsWithStatsLevel:(RocksDBStatsLevel)statsLevel
+{
+	RocksDBStatistics *statistics = [RocksDBStatistics new];
+	statistics.statsLevel = statsLevel;
+	[self measureOperationsWithStatistics:statistics];
+}
+
+- (void)testPerformance_StatsLevel_NoStatistics
+{
+	[self measureOperationsWithStatistics:nil];
+}
+
+- (void)testPerformance_StatsLevel_ExceptHistogramOrTimers
+{
+	[self measureOperationsWithStatsLevel:RocksDBStatsLevelExceptHistogramOrTimers];
+}
+
+- (void)testPerformance_StatsLevel_ExceptTimers
+{
+	[self measureOperationsWithStatsLevel:RocksDBStatsLevelExceptTimers];
+}
+
+- (void)testPerformance_StatsLevel_ExceptDetailedTimers
+{
+	[self measureOperationsWithStatsLevel:RocksDBStatsLevelExceptDetailedTimers];
+}
+
+- (void)testPerformance_StatsLevel_ExceptTimeForMutex
+{
+	[self measureOperationsWithStatsLevel:RocksDBStatsLevelExceptTimeForMutex];
+}
+
+- (void)testPerformance_StatsLevel_All
+{
+	[self measureOperationsWithStatsLevel:RocksDBStatsLevelAll];
+}
+
+- (void)testPerformance_Statistics_Snapshot
+{
+	RocksDBStatistics *statistics = [RocksDBStatistics new];
+
+	_rocks = [RocksDB databaseAtPath:_path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.statistics = statistics;
+	}];
+
+	[self measureBlock:^{
+		for (int i = 0; i < 1000; i++) {
+			[[statistics snapshot] countForTicker:RocksDBTickerBytesWritten];
+		}
+	}];
+}
+
 @end
@@ -42,6 +42,22 @@ class RocksDBStatisticsTests : RocksDBTests {
 		XCTAssertGreaterThan(statistics.count(for: RocksDBTicker.bytesRead), UInt64(0));
 	}
 
+	func testSwift_Statistics_StatsLevel() {
+		let statistics = RocksDBStatistics()
+		statistics.statsLevel = .exceptHistogramOrTimers
+
+		rocks = RocksDB.database(atPath: self.path, andDBOptions: { (options) -> Void in
+			options.createIfMissing = true
+			options.statistics = statistics;
+		})
+
+		try! rocks.setData("abcd", forKey: "abcd")
+
+		XCTAssertEqual(statistics.statsLevel, .exceptHistogramOrTimers)
+		XCTAssertEqual(statistics.count(for: RocksDBTicker.numberKeysWritten), UInt64(1));
+		XCTAssertEqual(statistics.histogramData(forType: RocksDBHistogram.dbWrite).count, UInt64(0));
+	}
+
 	func testSwift_Statistics_Histogram() {
 		let statistics = RocksDBStatistics()
 
@@ -62,4 +78,49 @@ class RocksDBStatisticsTests : RocksDBTests {
 		XCTAssertNotNil(dbGetHistogram);
 		XCTAssertGreaterThan(dbGetHistogram.median, 0.0);
 	}
+
+	func testSwift_Statistics_Histogram_Full() {
+		let statistics = RocksDBStatistics()
+
+		rocks = RocksDB.database(atPath: self.path, andDBOptions: { (options) -> Void in
+			options.createIfMissing = true
+			options.statistics = statistics;
+		})
+
+		for i in 0..<1000 {
+			let str = "a\(i)"
+			try! rocks.setData(str.data, forKey: str.data)
+		}
+
+		let histogram = statistics.histogramData(forType: RocksDBHistogram.bytesPerWrite)
+		XCTAssertEqual(histogram.count, UInt64(1000))
+		XCTAssertGreaterThan(histogram.percentile99, 0.0)
+		XCTAssertLessThanOrEqual(histogram.percentile999, histogram.max)
+		XCTAssertEqual(histogram.bucketCounts.reduce(0) { $0 + $1.uint64Value }, histogram.count)
+
+		let merged = histogram.merging(histogram)
+		XCTAssertEqual(merged.count, UInt64(2000))
+	}
+
+	func testSwift_Statistics_Snapshot() {
+		let statistics = RocksDBStatistics()
+
+		rocks = RocksDB.database(atPath: self.path, andDBOptions: { (options) -> Void in
+			options.createIfMissing = true
+			options.statistics = statistics;
+		})
+
+		try! rocks.setData("abcd", forKey: "abcd")
+
+		let first = statistics.snapshot()
+		XCTAssertEqual(first.count(for: RocksDBTicker.numberKeysWritten), UInt64(1))
+
+		_ = try! rocks.data(forKey: "abcd")
+		_ = try! rocks.data(forKey: "abcd")
+
+		let delta = statistics.snapshot().delta(from: first)
+		XCTAssertEqual(delta.count(for: RocksDBTicker.numberKeysRead), UInt64(2))
+		XCTAssertEqual(delta.count(for: RocksDBTicker.numberKeysWritten), UInt64(0))
+		XCTAssertEqual(delta.count(for: RocksDBHistogram.dbGet), UInt64(2))
+	}
 }
@@ -0,0 +1,86 @@
+//
+//  RocksDBWriteBufferManagerTests.mm
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+#import "RocksDBTests.h"
+
+@interface RocksDBWriteBufferManagerTests : RocksDBTests
+@end
+
+@implementation RocksDBWriteBufferManagerTests
+
+- (RocksDB *)databaseAtPath:(NSString *)path withWriteBufferManager:(RocksDBWriteBufferManager *)writeBufferManager
+{
+	return [RocksDB databaseAtPath:path andDBOptions:^(RocksDBOptions *options) {
+		options.createIfMissing = YES;
+		options.writeBufferSize = 64 * 1024 * 1024;
+		options.writeBufferManager = writeBufferManager;
+	}];
+}
+
+- (void)writeValuesIntoDatabase:(RocksDB *)database prefix:(NSString *)prefix
+{
+	NSMutableData *value = [NSMutableData dataWithLength:4096];
+	for (int i = 0; i < 1000; i++) {
+		NSString *key = [NSString stringWithFormat:@"%@%d", prefix, i];
+		[database setData:value forKey:key.data error:nil];
+	}
+}
+
+- (void)testWriteBufferManager_SharedBudget
+{
+	RocksDBWriteBufferManager *manager = [RocksDBWriteBufferManager writeBufferManagerWithBufferSize:1024 * 1024];
+	XCTAssertTrue(manager.isEnabled);
+	XCTAssertEqual(manager.bufferSize, 1024 * 1024);
+	XCTAssertEqual(manager.memoryUsage, 0);
+
+	_rocks = [self databaseAtPath:_path withWriteBufferManager:manager];
+	RocksDB *other = [self databaseAtPath:_backupPath withWriteBufferManager:manager];
+
+	[self writeValuesIntoDatabase:_rocks prefix:@"a"];
+	[self writeValuesIntoDatabase:other prefix:@"b"];
+
+	// Without the manager both 64MB memtables would hold all 8MB
+	XCTAssertGreaterThan(manager.memoryUsage, 0);
+	XCTAssertLessThan(manager.memoryUsage, 8 * 1024 * 1024);
+	XCTAssertLessThanOrEqual(manager.mutableMemTableMemoryUsage, manager.memoryUsage);
+
+	XCTAssertEqual([_rocks dataForKey:@"a0".data error:nil].length, 4096);
+	XCTAssertEqual([other dataForKey:@"b999".data error:nil].length, 4096);
+
+	[other close];
+}
+
+- (void)testWriteBufferManager_Disabled
+{
+	RocksDBWriteBufferManager *manager = [RocksDBWriteBufferManager writeBufferManagerWithBufferSize:0];
+	XCTAssertFalse(manager.isEnabled);
+
+	_rocks = [self databaseAtPath:_path withWriteBufferManager:manager];
+	[self writeValuesIntoDatabase:_rocks prefix:@"a"];
+
+	XCTAssertEqual([_rocks dataForKey:@"a0".data error:nil].length, 4096);
+}
+
+#if !(defined(ROCKSDB_LITE) && defined(TARGET_OS_IPHONE))
+
+- (void)testWriteBufferManager_ChargeCache
+{
+	RocksDBCache *cache = [RocksDBCache LRUCacheWithCapacity:16 * 1024 * 1024];
+	RocksDBWriteBufferManager *manager = [RocksDBWriteBufferManager writeBufferManagerWithBufferSize:4 * 1024 * 1024
+																							   cache:cache];
+
+	_rocks = [self databaseAtPath:_path withWriteBufferManager:manager];
+	[self writeValuesIntoDatabase:_rocks prefix:@"a"];
+
+	XCTAssertGreaterThan(manager.memoryUsage, 0);
+	XCTAssertGreaterThanOrEqual(cache.usage, manager.memoryUsage);
+}
+
+#endif
+
+@end
@@ -0,0 +1,28 @@
+//
+//  RocksDBWriteBufferManagerTests.swift
+//  ObjectiveRocks
+//
+//  Created by agent on 18/10/26.
+//  Copyright (c) 2026 BrainCookie. All rights reserved.
+//
+
+import XCTest
+import ObjectiveRocks
+
+class RocksDBWriteBufferManagerTests : RocksDBTests {
+
+	func testSwift_WriteBufferManager() {
+		let manager = RocksDBWriteBufferManager(bufferSize: 1024 * 1024)
+
+		rocks = RocksDB.database(atPath: self.path, andDBOptions: { (options) -> Void in
+			options.createIfMissing = true
+			options.writeBufferManager = manager
+		})
+
+		try! rocks.setData("value 1", forKey: "key 1")
+
+		XCTAssertTrue(manager.isEnabled)
+		XCTAssertEqual(manager.bufferSize, 1024 * 1024)
+		XCTAssertGreaterThan(manager.memoryUsage, 0)
+	}
+}